@@ -0,0 +1,732 @@
+// Timings for the headline comparisons of the library, one section each:
+//   maps      s21::unordered_map (Swiss table) against s21::map and
+//             std::unordered_map
+//   vector    push_back growth with memcpy, move and copy relocation,
+//             against std::vector
+//   parallel  strong scaling of s21::parallel::sort and reduce
+//   frozen    frozen_set (Eytzinger layout) lookups against s21::set and
+//             std::lower_bound on a sorted array, 1K to 4M keys
+//   balance   map with each balancing policy against four workloads
+//   interval  interval_map::overlapping against filtering every interval
+//   sharded   concurrent_unordered_map throughput against one mutex around
+//             s21::unordered_map
+//   skiplist  concurrent_skiplist_map throughput against one mutex around
+//             s21::map and against concurrent_unordered_map
+//   small     small_map against s21::map at 1 to 32 entries
+//   smallvec  small_vector around its inline capacity against s21::vector
+//   simd      simd::find/count/min/max/sum at each kernel level against the
+//             std:: algorithms
+//   bitvector count, set-bit scan and AND against s21::vector<bool> and
+//             std::vector<bool>, with the simd kernels and without
+//   radix     heap bytes per key of radix_map against s21::map
+//
+// Usage: bench [section]... (every section by default). Each figure is the
+// best of kRuns runs.
+
+#include <algorithm>
+#include <chrono>
+#include <malloc.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../containers/map.h"
+#include "../containers/set.h"
+#include "../containers/tree_balance.h"
+#include "../containers/vector.h"
+#include "../containers_plus/bitvector.h"
+#include "../containers_plus/concurrent_skiplist_map.h"
+#include "../containers_plus/concurrent_unordered_map.h"
+#include "../containers_plus/frozen_set.h"
+#include "../containers_plus/interval_map.h"
+#include "../containers_plus/parallel.h"
+#include "../containers_plus/radix_map.h"
+#include "../containers_plus/simd.h"
+#include "../containers_plus/small_map.h"
+#include "../containers_plus/small_vector.h"
+#include "../containers_plus/unordered_map.h"
+
+namespace {
+
+const int kRuns = 5;
+
+// keeps results alive so the timed work is not optimized away
+std::uint64_t sink = 0;
+
+// makes the compiler assume *p is read and written here, so work on it is
+// not optimized away
+template <class T>
+void escape(T* p) {
+  __asm__ volatile("" : : "g"(p) : "memory");
+}
+
+template <class F>
+double seconds(F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  return d.count();
+}
+
+template <class F>
+double best_seconds(F f) {
+  double best = 1e30;
+  for (int r = 0; r < kRuns; ++r) best = std::min(best, seconds(f));
+  return best;
+}
+
+double ns_per(double seconds, std::size_t n) { return seconds * 1e9 / n; }
+
+std::vector<std::uint64_t> random_keys(std::size_t n, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<std::uint64_t> keys(n);
+  for (std::uint64_t& k : keys) k = gen();
+  return keys;
+}
+
+/* maps */
+
+template <class Map>
+void map_row(const char* name, const std::vector<std::uint64_t>& keys,
+             const std::vector<std::uint64_t>& misses) {
+  double insert = best_seconds([&] {
+    Map m;
+    for (std::uint64_t k : keys) m.insert({k, k});
+    sink += m.size();
+  });
+  Map m;
+  for (std::uint64_t k : keys) m.insert({k, k});
+  double hit = best_seconds([&] {
+    for (std::uint64_t k : keys) sink += m.find(k) != m.end();
+  });
+  double miss = best_seconds([&] {
+    for (std::uint64_t k : misses) sink += m.find(k) == m.end();
+  });
+  std::printf("  %-20s %10.1f %10.1f %10.1f\n", name,
+              ns_per(insert, keys.size()), ns_per(hit, keys.size()),
+              ns_per(miss, misses.size()));
+}
+
+void bench_maps() {
+  const std::size_t n = 1 << 20;
+  std::vector<std::uint64_t> keys = random_keys(n, 1);
+  std::vector<std::uint64_t> misses = random_keys(n, 2);
+  std::printf("maps: %zu random 64-bit keys, ns per operation\n", n);
+  std::printf("  %-20s %10s %10s %10s\n", "", "insert", "find hit",
+              "find miss");
+  map_row<s21::unordered_map<std::uint64_t, std::uint64_t>>(
+      "s21::unordered_map", keys, misses);
+  map_row<s21::map<std::uint64_t, std::uint64_t>>("s21::map", keys, misses);
+  map_row<std::unordered_map<std::uint64_t, std::uint64_t>>(
+      "std::unordered_map", keys, misses);
+}
+
+/* vector */
+
+// a string the vector has to copy on growth: its move may throw, so
+// relocation falls back to copies, which is what every element type got
+// before relocation learned to move and memcpy
+struct copied_string {
+  copied_string(const char* s) : text{s} {}
+  copied_string(const copied_string&) = default;
+  copied_string(copied_string&& other) noexcept(false)
+      : text{std::move(other.text)} {}
+
+  std::string text;
+};
+
+template <class Vector, class T>
+double push_back_seconds(std::size_t n, const T& value) {
+  return best_seconds([&] {
+    Vector v;
+    for (std::size_t i = 0; i < n; ++i) v.push_back(value);
+    sink += v.size();
+  });
+}
+
+template <class T>
+void vector_row(const char* name, std::size_t n, const T& value) {
+  std::printf("  %-28s %10.2f %10.2f\n", name,
+              ns_per(push_back_seconds<s21::vector<T>>(n, value), n),
+              ns_per(push_back_seconds<std::vector<T>>(n, value), n));
+}
+
+void bench_vector() {
+  const std::size_t n = 1 << 20;
+  const char* text = "a string long enough to live on the heap";
+  std::printf("vector: %zu push_backs into an empty vector, ns per element\n",
+              n);
+  std::printf("  %-28s %10s %10s\n", "", "s21", "std");
+  vector_row("int (memcpy)", n, 1);
+  vector_row("std::string (move)", n, std::string(text));
+  vector_row("copied_string (copy)", n, copied_string(text));
+}
+
+/* parallel */
+
+void bench_parallel() {
+  const std::size_t n = 1 << 24;
+  std::vector<std::uint64_t> keys = random_keys(n, 3);
+  const std::size_t hardware =
+      std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  std::printf("parallel: %zu 64-bit values, %zu hardware threads\n", n,
+              hardware);
+  std::printf("  %-8s %10s %8s %10s %8s\n", "threads", "sort ms", "speedup",
+              "reduce ms", "speedup");
+
+  double sort1 = 0, reduce1 = 0;
+  for (std::size_t threads = 1; threads <= std::max<std::size_t>(8, hardware);
+       threads *= 2) {
+    s21::parallel::set_thread_count(threads);
+    s21::vector<std::uint64_t> v;
+    double sort = 1e30;
+    for (int r = 0; r < kRuns; ++r) {
+      // sorting is timed on a fresh copy every run
+      v = s21::vector<std::uint64_t>(keys.begin(), keys.end());
+      sort = std::min(
+          sort, seconds([&] { s21::parallel::sort(v.begin(), v.end()); }));
+    }
+    double reduce = best_seconds([&] {
+      sink += s21::parallel::reduce(v.begin(), v.end(), std::uint64_t(0));
+    });
+    if (threads == 1) {
+      sort1 = sort;
+      reduce1 = reduce;
+    }
+    std::printf("  %-8zu %10.1f %8.2f %10.1f %8.2f\n", threads, sort * 1e3,
+                sort1 / sort, reduce * 1e3, reduce1 / reduce);
+  }
+  s21::parallel::set_thread_count(0);
+}
+
+/* frozen */
+
+// 2^22 keys keep the s21::set under half a gigabyte; larger sizes show the
+// same trend with more cache misses per lookup
+void bench_frozen() {
+  const std::size_t lookups = 1 << 20;
+  std::printf("frozen: %zu lookups, half of them hits, ns per lookup\n",
+              lookups);
+  std::printf("  %-10s %10s %10s %14s\n", "keys", "s21::set", "frozen",
+              "lower_bound");
+  for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 16,
+                        std::size_t(1) << 20, std::size_t(1) << 22}) {
+    std::vector<std::uint64_t> keys = random_keys(n, 4);
+    std::vector<std::uint64_t> probes = random_keys(lookups, 5);
+    std::mt19937_64 gen(6);
+    for (std::size_t i = 0; i < lookups; i += 2) probes[i] = keys[gen() % n];
+
+    s21::set<std::uint64_t> tree;
+    for (std::uint64_t k : keys) tree.insert(k);
+    s21::frozen_set<std::uint64_t> frozen(tree);
+    std::vector<std::uint64_t> sorted(keys);
+    std::sort(sorted.begin(), sorted.end());
+
+    double t_tree = best_seconds([&] {
+      for (std::uint64_t k : probes) sink += tree.find(k) != tree.end();
+    });
+    double t_frozen = best_seconds([&] {
+      for (std::uint64_t k : probes) sink += frozen.contains(k);
+    });
+    double t_sorted = best_seconds([&] {
+      for (std::uint64_t k : probes) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), k);
+        sink += it != sorted.end() && *it == k;
+      }
+    });
+    std::printf("  %-10zu %10.1f %10.1f %14.1f\n", n, ns_per(t_tree, lookups),
+                ns_per(t_frozen, lookups), ns_per(t_sorted, lookups));
+  }
+}
+
+/* balance */
+
+template <class Balance>
+void balance_row(const char* name, const std::vector<std::uint64_t>& keys) {
+  typedef s21::map<std::uint64_t, std::uint64_t, std::less<std::uint64_t>,
+                   Balance>
+      map_type;
+  const std::size_t n = keys.size();
+  double sequential = best_seconds([&] {
+    map_type m;
+    for (std::size_t i = 0; i < n; ++i) m.insert({i, i});
+    sink += m.size();
+  });
+  double random = best_seconds([&] {
+    map_type m;
+    for (std::uint64_t k : keys) m.insert({k, k});
+    sink += m.size();
+  });
+  map_type m;
+  for (std::uint64_t k : keys) m.insert({k, k});
+  double find = best_seconds([&] {
+    for (std::uint64_t k : keys) sink += m.find(k) != m.end();
+  });
+  // erases half of the keys, then puts them back for the next run
+  double churn = best_seconds([&] {
+    for (std::size_t i = 0; i < n; i += 2) sink += m.erase(keys[i]);
+    for (std::size_t i = 0; i < n; i += 2) m.insert({keys[i], keys[i]});
+  });
+  std::printf("  %-8s %12.1f %12.1f %12.1f %12.1f\n", name,
+              ns_per(sequential, n), ns_per(random, n), ns_per(find, n),
+              ns_per(churn, n));
+}
+
+void bench_balance() {
+  const std::size_t n = 1 << 18;
+  std::vector<std::uint64_t> keys = random_keys(n, 7);
+  std::printf("balance: s21::map with %zu keys, ns per key\n", n);
+  std::printf("  %-8s %12s %12s %12s %12s\n", "policy", "seq insert",
+              "rand insert", "rand find", "erase+insert");
+  balance_row<RBBalance>("RB", keys);
+  balance_row<AVLBalance>("AVL", keys);
+  balance_row<WAVLBalance>("WAVL", keys);
+  balance_row<TreapBalance>("treap", keys);
+}
+
+/* interval */
+
+void bench_interval() {
+  const std::size_t queries = 1 << 10;
+  std::printf("interval: %zu window queries, us per query\n", queries);
+  std::printf("  %-10s %10s %10s %10s\n", "intervals", "matches", "tree",
+              "linear");
+  for (std::size_t n : {std::size_t(1) << 10, std::size_t(1) << 14,
+                        std::size_t(1) << 18}) {
+    // intervals up to 2^20 long starting anywhere below 2^32, so a window
+    // of 2^20 meets about n / 2700 of them
+    std::mt19937_64 gen(8);
+    const std::uint64_t span = std::uint64_t(1) << 32, len = 1 << 20;
+    s21::interval_map<std::uint64_t, std::uint64_t> tree;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> flat;
+    while (flat.size() < n) {
+      std::uint64_t lo = gen() % span, hi = lo + 1 + gen() % len;
+      if (tree.insert(lo, hi, lo).second) flat.emplace_back(lo, hi);
+    }
+    std::vector<std::uint64_t> starts(queries);
+    for (std::uint64_t& s : starts) s = gen() % span;
+
+    std::size_t matches = 0;
+    double t_tree = best_seconds([&] {
+      matches = 0;
+      for (std::uint64_t s : starts)
+        matches += tree.overlapping(s, s + len).size();
+    });
+    double t_linear = best_seconds([&] {
+      for (std::uint64_t s : starts)
+        for (const auto& iv : flat)
+          sink += iv.first < s + len && s < iv.second;
+    });
+    std::printf("  %-10zu %10.1f %10.2f %10.2f\n", n,
+                double(matches) / queries, t_tree * 1e6 / queries,
+                t_linear * 1e6 / queries);
+  }
+}
+
+/* sharded */
+
+// a map behind one mutex, the baseline of the concurrent maps
+template <class Map>
+class locked {
+ public:
+  bool contains(std::uint64_t k) const {
+    std::lock_guard<std::mutex> lock(m);
+    return map.find(k) != map.end();
+  }
+  void insert_or_assign(std::uint64_t k, std::uint64_t v) {
+    std::lock_guard<std::mutex> lock(m);
+    map.insert_or_assign(k, v);
+  }
+
+ private:
+  mutable std::mutex m;
+  Map map;
+};
+
+const std::uint64_t kKeySpace = 1 << 16;
+const std::size_t kOpsPerThread = 1 << 18;
+
+// million operations per second of threads running reads and, one time in
+// write_every, insert_or_assign on random keys of a prefilled map
+template <class Map>
+double mixed_mops(std::size_t threads, unsigned write_every) {
+  Map m;
+  for (std::uint64_t k = 0; k < kKeySpace; k += 2) m.insert_or_assign(k, k);
+  std::vector<std::uint64_t> hits(threads);
+  double t = best_seconds([&] {
+    std::vector<std::thread> pool;
+    for (std::size_t i = 0; i < threads; ++i)
+      pool.emplace_back([&m, &hits, i, write_every] {
+        std::mt19937_64 gen(i);
+        for (std::size_t op = 0; op < kOpsPerThread; ++op) {
+          std::uint64_t k = gen() % kKeySpace;
+          if (op % write_every == 0)
+            m.insert_or_assign(k, op);
+          else
+            hits[i] += m.contains(k);
+        }
+      });
+    for (std::thread& th : pool) th.join();
+  });
+  for (std::uint64_t h : hits) sink += h;
+  return threads * kOpsPerThread / t / 1e6;
+}
+
+// thread counts 1, 2, 4, 8 and on up to the hardware threads
+std::vector<std::size_t> thread_counts() {
+  const std::size_t hardware =
+      std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  std::vector<std::size_t> res;
+  for (std::size_t n = 1; n <= std::max<std::size_t>(8, hardware); n *= 2)
+    res.push_back(n);
+  return res;
+}
+
+void bench_sharded() {
+  std::printf(
+      "sharded: %zu ops per thread on %llu keys, reads/writes, Mops/s\n",
+      kOpsPerThread, static_cast<unsigned long long>(kKeySpace));
+  std::printf("  %-8s %14s %14s %14s %14s\n", "threads", "sharded 90/10",
+              "locked 90/10", "sharded 50/50", "locked 50/50");
+  typedef s21::concurrent_unordered_map<std::uint64_t, std::uint64_t> sharded;
+  typedef locked<s21::unordered_map<std::uint64_t, std::uint64_t>> one_lock;
+  for (std::size_t n : thread_counts())
+    std::printf("  %-8zu %14.2f %14.2f %14.2f %14.2f\n", n,
+                mixed_mops<sharded>(n, 10), mixed_mops<one_lock>(n, 10),
+                mixed_mops<sharded>(n, 2), mixed_mops<one_lock>(n, 2));
+}
+
+/* skiplist */
+
+void bench_skiplist() {
+  std::printf(
+      "skiplist: %zu ops per thread on %llu keys, reads/writes, Mops/s\n",
+      kOpsPerThread, static_cast<unsigned long long>(kKeySpace));
+  std::printf("  %-8s %14s %14s %14s %14s\n", "threads", "skiplist 90/10",
+              "locked 90/10", "sharded 90/10", "skiplist 50/50");
+  typedef s21::concurrent_skiplist_map<std::uint64_t, std::uint64_t> skiplist;
+  typedef locked<s21::map<std::uint64_t, std::uint64_t>> one_lock;
+  typedef s21::concurrent_unordered_map<std::uint64_t, std::uint64_t> sharded;
+  for (std::size_t n : thread_counts())
+    std::printf("  %-8zu %14.2f %14.2f %14.2f %14.2f\n", n,
+                mixed_mops<skiplist>(n, 10), mixed_mops<one_lock>(n, 10),
+                mixed_mops<sharded>(n, 10), mixed_mops<skiplist>(n, 2));
+}
+
+/* small */
+
+// builds many maps of n entries and looks every key up in each; returns ns
+// per entry for building (and destroying) and for the lookups
+template <class Map>
+std::pair<double, double> small_map_ns(std::size_t n) {
+  const std::size_t total = 1 << 20, maps = total / n;
+  std::vector<std::uint64_t> keys = random_keys(n, 9);
+  double build = best_seconds([&] {
+    for (std::size_t i = 0; i < maps; ++i) {
+      Map m;
+      for (std::uint64_t k : keys) m.insert({k, k});
+      sink += m.size();
+    }
+  });
+  Map m;
+  for (std::uint64_t k : keys) m.insert({k, k});
+  double find = best_seconds([&] {
+    for (std::size_t i = 0; i < maps; ++i)
+      for (std::uint64_t k : keys) sink += m.find(k) != m.end();
+  });
+  return {ns_per(build, maps * n), ns_per(find, maps * n)};
+}
+
+void bench_small() {
+  std::printf("small: many maps of n entries, ns per entry\n");
+  std::printf("  %-4s %12s %12s %12s %12s\n", "n", "small build",
+              "map build", "small find", "map find");
+  typedef s21::small_map<std::uint64_t, std::uint64_t, 8> small;
+  typedef s21::map<std::uint64_t, std::uint64_t> tree;
+  for (std::size_t n : {1, 2, 4, 8, 16, 32}) {
+    std::pair<double, double> s = small_map_ns<small>(n);
+    std::pair<double, double> t = small_map_ns<tree>(n);
+    std::printf("  %-4zu %12.1f %12.1f %12.1f %12.1f\n", n, s.first, t.first,
+                s.second, t.second);
+  }
+}
+
+/* smallvec */
+
+// ns to fill a vector with n ints and destroy it, and ns to move a filled
+// one out and back
+template <class Vector>
+std::pair<double, double> small_vector_ns(std::size_t n) {
+  const std::size_t reps = (1 << 22) / n;
+  double fill = best_seconds([&] {
+    for (std::size_t r = 0; r < reps; ++r) {
+      Vector v;
+      for (std::size_t i = 0; i < n; ++i) v.push_back(int(i));
+      sink += v.size();
+    }
+  });
+  Vector v;
+  for (std::size_t i = 0; i < n; ++i) v.push_back(int(i));
+  double move = best_seconds([&] {
+    for (std::size_t r = 0; r < reps; ++r) {
+      Vector tmp(std::move(v));
+      escape(&tmp);
+      v = std::move(tmp);
+      escape(&v);
+    }
+  });
+  return {ns_per(fill, reps), ns_per(move, reps)};
+}
+
+void bench_smallvec() {
+  std::printf("smallvec: small_vector<int, 16>, ns per vector\n");
+  std::printf("  %-4s %12s %12s %12s %12s\n", "n", "small fill",
+              "vector fill", "small move", "vector move");
+  typedef s21::small_vector<int, 16> small;
+  for (std::size_t n : {4, 8, 15, 16, 17, 32, 64}) {
+    std::pair<double, double> s = small_vector_ns<small>(n);
+    std::pair<double, double> v = small_vector_ns<s21::vector<int>>(n);
+    std::printf("  %-4zu %12.1f %12.1f %12.2f %12.2f\n", n, s.first, v.first,
+                s.second, v.second);
+  }
+}
+
+/* simd */
+
+void simd_row(const char* name, const s21::vector<std::int32_t>& v,
+              void (*std_version)(const s21::vector<std::int32_t>&),
+              void (*simd_version)(const s21::vector<std::int32_t>&)) {
+  const s21::simd::level levels[] = {
+      s21::simd::level::scalar, s21::simd::level::sse2,
+      s21::simd::level::avx2, s21::simd::level::avx512};
+  std::printf("  %-6s %8.1f", name,
+              ns_per(best_seconds([&] { std_version(v); }), v.size()) * 1e3);
+  for (s21::simd::level l : levels) {
+    if (l > s21::simd::detected_level()) {
+      std::printf(" %8s", "-");
+      continue;
+    }
+    s21::simd::set_level(l);
+    std::printf(" %8.1f",
+                ns_per(best_seconds([&] { simd_version(v); }), v.size()) *
+                    1e3);
+  }
+  s21::simd::set_level(s21::simd::detected_level());
+  std::printf("\n");
+}
+
+void bench_simd() {
+  const std::size_t n = 1 << 22;
+  s21::vector<std::int32_t> v;
+  std::mt19937 gen(10);
+  for (std::size_t i = 0; i < n; ++i) v.push_back(std::int32_t(gen() >> 8));
+  typedef const s21::vector<std::int32_t>& arg;
+  std::printf("simd: %zu int32 elements, ps per element (- not supported)\n",
+              n);
+  std::printf("  %-6s %8s %8s %8s %8s %8s\n", "", "std", "scalar", "sse2",
+              "avx2", "avx512");
+  // -1 is never stored, so find and count scan everything
+  simd_row(
+      "find", v,
+      [](arg a) { sink += std::find(a.begin(), a.end(), -1) == a.end(); },
+      [](arg a) { sink += s21::simd::find(a, -1) == a.end(); });
+  simd_row(
+      "count", v,
+      [](arg a) { sink += std::count(a.begin(), a.end(), -1); },
+      [](arg a) { sink += s21::simd::count(a, -1); });
+  simd_row(
+      "min", v, [](arg a) { sink += *std::min_element(a.begin(), a.end()); },
+      [](arg a) { sink += s21::simd::min(a); });
+  simd_row(
+      "max", v, [](arg a) { sink += *std::max_element(a.begin(), a.end()); },
+      [](arg a) { sink += s21::simd::max(a); });
+  simd_row(
+      "sum", v,
+      [](arg a) {
+        sink += std::accumulate(a.begin(), a.end(), std::uint32_t(0));
+      },
+      [](arg a) { sink += std::uint32_t(s21::simd::sum(a)); });
+}
+
+/* bitvector */
+
+// ps per bit to count the set bits, to visit each of them and to AND in a
+// second array, and the bytes the flags take
+struct flag_times {
+  double count, scan, and_, bytes;
+};
+
+// one flag per element: s21::vector<bool> (a byte each) or
+// std::vector<bool> (packed, reached bit by bit)
+template <class Flags>
+flag_times element_flags(const std::vector<bool>& a,
+                         const std::vector<bool>& b, double bytes_per_bit) {
+  Flags x(a.begin(), a.end()), y(b.begin(), b.end());
+  const std::size_t n = a.size();
+  flag_times t;
+  t.count = best_seconds([&] { sink += std::count(x.begin(), x.end(), true); });
+  t.scan = best_seconds([&] {
+    for (std::size_t i = 0; i < n; ++i)
+      if (x[i]) sink += i;
+  });
+  t.and_ = best_seconds([&] {
+    for (std::size_t i = 0; i < n; ++i) x[i] = x[i] && y[i];
+    escape(&x);
+  });
+  t.bytes = x.capacity() * bytes_per_bit;
+  return t;
+}
+
+flag_times packed_flags(const std::vector<bool>& a,
+                        const std::vector<bool>& b) {
+  s21::bitvector x(a.size()), y(b.size());
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    x[i] = a[i];
+    y[i] = b[i];
+  }
+  flag_times t;
+  t.count = best_seconds([&] { sink += x.count(); });
+  t.scan = best_seconds([&] {
+    for (std::size_t i = x.find_first(); i != x.npos; i = x.find_next(i))
+      sink += i;
+  });
+  t.and_ = best_seconds([&] {
+    x &= y;
+    escape(&x);
+  });
+  t.bytes = x.word_size() * 8.0;
+  return t;
+}
+
+void bench_bitvector() {
+  const std::size_t n = 1 << 26;
+  std::vector<bool> a(n), b(n);
+  std::mt19937_64 gen(11);
+  for (std::size_t i = 0; i < n; ++i) {
+    a[i] = gen() % 64 == 0;
+    b[i] = gen() % 2 == 0;
+  }
+  flag_times bytes = element_flags<s21::vector<bool>>(a, b, 1.0);
+  flag_times stdv = element_flags<std::vector<bool>>(a, b, 1.0 / 8);
+  flag_times packed = packed_flags(a, b);
+  s21::simd::set_level(s21::simd::level::scalar);
+  flag_times scalar = packed_flags(a, b);
+  s21::simd::set_level(s21::simd::detected_level());
+
+  std::printf("bitvector: %zu bits, 1 in 64 set, ps per bit\n", n);
+  std::printf("  %-6s %14s %18s %10s %16s\n", "", "vector<bool>",
+              "std::vector<bool>", "bitvector", "bitvector scalar");
+  const flag_times* cols[] = {&bytes, &stdv, &packed, &scalar};
+  const char* names[] = {"count", "scan", "and"};
+  double flag_times::*fields[] = {&flag_times::count, &flag_times::scan,
+                                  &flag_times::and_};
+  for (int r = 0; r < 3; ++r)
+    std::printf("  %-6s %14.1f %18.1f %10.1f %16.1f\n", names[r],
+                ns_per(cols[0]->*fields[r], n) * 1e3,
+                ns_per(cols[1]->*fields[r], n) * 1e3,
+                ns_per(cols[2]->*fields[r], n) * 1e3,
+                ns_per(cols[3]->*fields[r], n) * 1e3);
+  std::printf("  %-6s %14.1f %18.1f %10.1f %16.1f\n", "MiB",
+              bytes.bytes / (1 << 20), stdv.bytes / (1 << 20),
+              packed.bytes / (1 << 20), scalar.bytes / (1 << 20));
+}
+
+/* radix */
+
+// bytes of live heap, glibc's count including the malloc headers
+std::size_t heap_bytes() {
+  struct mallinfo2 mi = mallinfo2();
+  return mi.uordblks + mi.hblkhd;
+}
+
+// heap bytes per key of a map holding keys
+template <class Map, class Key>
+double bytes_per_key(const std::vector<Key>& keys) {
+  const std::size_t before = heap_bytes();
+  Map m;
+  for (const Key& k : keys) m.insert({k, 0});
+  sink += m.size();
+  return double(heap_bytes() - before) / keys.size();
+}
+
+// heap bytes per key that the keys own themselves (string buffers), which
+// both maps pay for their copy of the key
+template <class Key>
+double key_bytes(const std::vector<Key>& keys) {
+  const std::size_t before = heap_bytes();
+  std::vector<Key> copy(keys);
+  return double(heap_bytes() - before - copy.capacity() * sizeof(Key)) /
+         keys.size();
+}
+
+template <class Key>
+void radix_row(const char* name, const std::vector<Key>& keys) {
+  std::printf("  %-22s %10.1f %10.1f %10.1f\n", name,
+              bytes_per_key<s21::radix_map<Key, int>>(keys),
+              bytes_per_key<s21::map<Key, int>>(keys), key_bytes(keys));
+}
+
+void bench_radix() {
+  const std::size_t n = 200000;
+  // URLs under 50 sections, with ids numbered per section or scattered
+  std::vector<std::string> dense, sparse;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::string section = "https://www.example.com/catalog/section-" +
+                          std::to_string(i % 50) + "/products/item-";
+    dense.push_back(section + std::to_string(i / 50));
+    sparse.push_back(section + std::to_string(i * 7919 % 1000003));
+  }
+  std::vector<std::uint64_t> sequential(n);
+  std::iota(sequential.begin(), sequential.end(), 0);
+
+  std::printf("radix: %zu keys, heap bytes per key\n", n);
+  std::printf("  %-22s %10s %10s %10s\n", "", "radix_map", "s21::map",
+              "key heap");
+  radix_row("URL, dense ids", dense);
+  radix_row("URL, sparse ids", sparse);
+  radix_row("uint64, sequential", sequential);
+  radix_row("uint64, random", random_keys(n, 12));
+}
+
+struct section {
+  const char* name;
+  void (*run)();
+};
+
+const section kSections[] = {
+    {"maps", bench_maps},
+    {"vector", bench_vector},
+    {"parallel", bench_parallel},
+    {"frozen", bench_frozen},
+    {"balance", bench_balance},
+    {"interval", bench_interval},
+    {"sharded", bench_sharded},
+    {"skiplist", bench_skiplist},
+    {"small", bench_small},
+    {"smallvec", bench_smallvec},
+    {"simd", bench_simd},
+    {"bitvector", bench_bitvector},
+    {"radix", bench_radix},
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  for (const section& s : kSections) {
+    bool wanted = argc < 2;
+    for (int i = 1; i < argc; ++i)
+      if (std::strcmp(argv[i], s.name) == 0) wanted = true;
+    if (wanted) s.run();
+  }
+  std::printf("(checksum %llu)\n", static_cast<unsigned long long>(sink));
+  return 0;
+}
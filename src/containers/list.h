@@ -51,10 +51,10 @@ class list {
     for (node_ptr i = other.head; i; i = i->next) push_back(i->key);
   }
 
+  /* Copy assignment and assign() overwrite the existing nodes in place and
+   * allocate or free only the difference in length */
   list &operator=(const list &other) {
-    if (this == &other) return *this;
-    list tmp{other};
-    std::swap(*this, tmp);
+    if (this != &other) assign_range(other.cbegin(), other.cend());
     return *this;
   }
 
@@ -91,14 +91,18 @@ class list {
   ~list() { dealloc(0); }
 
   list &operator=(std::initializer_list<T> ilist) {
-    list tmp{ilist};
-    std::swap(*this, tmp);
+    assign_range(ilist.begin(), ilist.end());
     return *this;
   }
 
   void assign(size_type count, const T &value) {
-    list tmp(count, value);
-    *this = tmp;
+    size_type i = 0;
+    for (node_ptr n = head; n != nullptr && i < count; n = n->next, ++i)
+      n->key = value;
+    if (i == count)
+      dealloc(count);
+    else
+      while (sz != count) push_back(value);
   }
 
   template <typename InputIt,
@@ -107,13 +111,11 @@ class list {
                                 typename std::iterator_traits<
                                     InputIt>::iterator_category>::value>::type>
   void assign(InputIt first, InputIt last) {
-    list tmp{first, last};
-    std::swap(*this, tmp);
+    assign_range(first, last);
   }
 
   void assign(std::initializer_list<T> ilist) {
-    list tmp{ilist};
-    *this = tmp;
+    assign_range(ilist.begin(), ilist.end());
   }
 
   allocator_type get_allocator() const noexcept { return allocator; }
@@ -519,6 +521,17 @@ class list {
     other.sz = 0;
   }
 
+  /* Moves the node it from other in front of pos without reallocating it;
+   * other may be *this */
+  void splice(const_iterator pos, list &other, const_iterator it) {
+    node_ptr node = it.get_ptr();
+    node_ptr before = pos.get_ptr();
+    if (this == &other && (node == before || node->next == before)) return;
+
+    other.unlink(node);
+    link_before(before, node);
+  }
+
   void remove(const T &value) {
     node_ptr tmp = head;
     while (tmp != nullptr) {
@@ -857,6 +870,46 @@ node_ptr Merge(node_ptr leftHead, node_ptr rightHead) {
   return mergedHead;
 }
 
+  void unlink(node_ptr node) noexcept {
+    if (node->prev)
+      node->prev->next = node->next;
+    else
+      head = node->next;
+    if (node->next)
+      node->next->prev = node->prev;
+    else
+      tail = node->prev;
+    node->prev = node->next = nullptr;
+    --sz;
+  }
+
+  // before == nullptr appends
+  void link_before(node_ptr before, node_ptr node) noexcept {
+    node->next = before;
+    node->prev = before ? before->prev : tail;
+    if (node->prev)
+      node->prev->next = node;
+    else
+      head = node;
+    if (before)
+      before->prev = node;
+    else
+      tail = node;
+    ++sz;
+  }
+
+  template <typename InputIt>
+  void assign_range(InputIt first, InputIt last) {
+    size_type i = 0;
+    for (node_ptr n = head; n != nullptr && first != last;
+         n = n->next, ++first, ++i)
+      n->key = *first;
+    if (first == last)
+      dealloc(i);
+    else
+      for (; first != last; ++first) push_back(*first);
+  }
+
   void dealloc(size_type count) {
     if (tail && sz > count) {
       node_ptr tmp = tail, pre = tmp->prev;
@@ -1,24 +1,38 @@
 #ifndef _STL_CONTAINERS_CONTAINERS_MAP_H_
 #define _STL_CONTAINERS_CONTAINERS_MAP_H_
 
+#include <type_traits>
+
 #include "rb_tree.h"
 
 namespace s21 {
 
-template <class Key, class T, class Compare = std::less<Key>>
+/* Augment is a monoid over the values (see tree_augment.h); with it map
+ * computes aggregate(lo, hi) in O(log n). The values of such a map change
+ * only through insert_or_assign: the mutable at() and operator[] are
+ * disabled, since writes through them would not update the folds.
+ * Filter (see tree_filter.h), e.g. BloomFilter<Key>, cuts off lookups of
+ * absent keys.
+ */
+template <class Key, class T, class Compare = std::less<Key>,
+          class Balance = RBBalance, class Augment = void,
+          class Filter = NoFilter>
 class map {
  public:
-  typedef RBTree<Key, T, Compare> rb_tree;
-  typedef typename RBTree<Key, T, Compare>::key_type key_type;
-  typedef typename RBTree<Key, T, Compare>::mapped_type mapped_type;
-  typedef typename RBTree<Key, T, Compare>::value_type value_type;
-  typedef typename RBTree<Key, T, Compare>::size_type size_type;
-  typedef typename RBTree<Key, T, Compare>::key_compare key_compare;
-  typedef typename RBTree<Key, T, Compare>::allocator_type allocator_type;
-  typedef typename RBTree<Key, T, Compare>::reference reference;
-  typedef typename RBTree<Key, T, Compare>::const_reference const_reference;
-  typedef typename RBTree<Key, T, Compare>::iterator iterator;
-  typedef typename RBTree<Key, T, Compare>::const_iterator const_iterator;
+  typedef RBTree<Key, T, Compare, std::allocator<RBNode<Key, T>>, Balance,
+                 Augment, Filter>
+      rb_tree;
+  typedef typename rb_tree::key_type key_type;
+  typedef typename rb_tree::mapped_type mapped_type;
+  typedef typename rb_tree::value_type value_type;
+  typedef typename rb_tree::size_type size_type;
+  typedef typename rb_tree::key_compare key_compare;
+  typedef typename rb_tree::allocator_type allocator_type;
+  typedef typename rb_tree::reference reference;
+  typedef typename rb_tree::const_reference const_reference;
+  typedef typename rb_tree::iterator iterator;
+  typedef typename rb_tree::const_iterator const_iterator;
+  typedef typename rb_tree::summary_type summary_type;
 
   map() : tree{} {}
 
@@ -45,11 +59,17 @@ class map {
 
   ~map() = default;
 
-  T& at(const Key& key) { return tree.at(key); }
+  template <class A = Augment, class = std::enable_if_t<std::is_void_v<A>>>
+  T& at(const Key& key) {
+    return tree.at(key);
+  }
 
   const T& at(const Key& key) const { return tree.at(key); }
 
-  T& operator[](const Key& key) { return tree[key]; }
+  template <class A = Augment, class = std::enable_if_t<std::is_void_v<A>>>
+  T& operator[](const Key& key) {
+    return tree[key];
+  }
 
   iterator begin() noexcept { return tree.begin(); }
 
@@ -73,6 +93,10 @@ class map {
     return tree.insert(value);
   }
 
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    return tree.insert_or_assign(key, obj);
+  }
+
   template <class... Args>
   std::vector<std::pair<iterator, bool>> emplace(Args&&... args) {
     return tree.unique_emplace_m(args...);
@@ -82,10 +106,31 @@ class map {
 
   void swap(map& other) noexcept { return tree.swap(other.tree); }
 
+  /* TreapBalance only: moves the keys not less than key into the result */
+  map split(const key_type& key) {
+    static_assert(std::is_same_v<Balance, TreapBalance>,
+                  "split/join need TreapBalance");
+    map rest;
+    rest.tree = tree.split(key);
+    return rest;
+  }
+
+  /* TreapBalance only: appends other, whose keys are not less than ours */
+  void join(map& other) {
+    static_assert(std::is_same_v<Balance, TreapBalance>,
+                  "split/join need TreapBalance");
+    tree.join(other.tree);
+  }
+
   iterator find(const Key& key) { return tree.find(key); }
 
   const_iterator find(const Key& key) const { return tree.find(key); }
 
+  /* Fold of Augment over the values with keys in [lo, hi) */
+  summary_type aggregate(const Key& lo, const Key& hi) const {
+    return tree.aggregate(lo, hi);
+  }
+
  private:
   rb_tree tree;
 };
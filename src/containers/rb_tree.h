@@ -3,9 +3,15 @@
 
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "tree_augment.h"
+#include "tree_balance.h"
+#include "tree_filter.h"
+
 /* Красно-чёрным называется бинарное поисковое дерево, у которого каждому узлу
  * сопоставлен дополнительный атрибут — цвет и для которого выполняются
  * следующие свойства:
@@ -16,32 +22,39 @@
     4) Все простые пути из любого узла x до листьев содержат одинаковое
        количество чёрных узлов
     5) Чёрный узел может иметь чёрного родителя
-*/
 
-enum class Color { RED, BLACK };
+    Балансировка вынесена в политику (tree_balance.h): кроме красно-чёрной
+    есть AVL, WAVL и декартово дерево, все за тем же интерфейсом.
+
+    Filter (tree_filter.h) отсекает поиск отсутствующих ключей до спуска
+    по дереву; по умолчанию фильтра нет.
+*/
 
-template <typename K, typename V>
-struct RBNode {
+template <typename K, typename V, class Augment = void>
+struct RBNode : RBNodeSummary<Augment> {
   K key;
   V value;
   RBNode* left;
   RBNode* right;
   RBNode* parent;
   Color color;
+  int rank;  // высота, ранг или приоритет - зависит от политики балансировки
   RBNode(K k, V v, Color c = Color::RED)
       : key{k},
         value{v},
         left{nullptr},
         right{nullptr},
         parent{nullptr},
-        color{c} {}
+        color{c},
+        rank{0} {}
   RBNode(std::pair<K, V> p, Color c = Color::RED)
       : key{p.first},
         value{p.second},
         left{nullptr},
         right{nullptr},
         parent{nullptr},
-        color{c} {}
+        color{c},
+        rank{0} {}
 
   void printData() {
     std::cout << "\naddressNode = " << this << "\nkey = " << key
@@ -96,12 +109,20 @@ struct RBNode {
 };
 
 template <typename K, typename V, class Compare = std::less<K>,
-          class Allocator = std::allocator<RBNode<K, V>>>
+          class Allocator = std::allocator<RBNode<K, V>>,
+          class Balance = RBBalance, class Augment = void,
+          class Filter = NoFilter>
 class RBTree {
-  typedef RBNode<K, V>* node_ptr;
+  typedef RBNode<K, V, Augment>* node_ptr;
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<
+      RBNode<K, V, Augment>>
+      node_allocator;
   node_ptr root;
-  Allocator alloc;
+  node_allocator alloc;
   Compare comp;
+  Filter filter;
+
+  friend Balance;
 
  public:
   typedef K key_type;
@@ -111,38 +132,68 @@ class RBTree {
   typedef std::ptrdiff_t difference_type;
   typedef Compare key_compare;
   typedef Allocator allocator_type;
+  typedef Balance balance_type;
   typedef value_type& reference;
   typedef const value_type& const_reference;
   typedef typename std::allocator_traits<Allocator>::pointer pointer;
   typedef
       typename std::allocator_traits<Allocator>::const_pointer const_pointer;
-  typedef RBNode<K, V> node_type;
+  typedef RBNode<K, V, Augment> node_type;
+  typedef typename AugmentTraits<Augment>::value_type summary_type;
+  typedef Filter filter_type;
 
   class iterator;
   class const_iterator;
 
-  RBTree() : root{nullptr}, alloc{}, comp{} {}
+  RBTree() : root{nullptr}, alloc{}, comp{}, filter{} {}
 
   RBTree(const RBTree& other)
-      : root{nullptr}, alloc{other.alloc}, comp{other.comp} {
-    if (other.root != nullptr) root = copy_node(other.root, nullptr);
+      : root{nullptr},
+        alloc{other.alloc},
+        comp{other.comp},
+        filter{other.filter} {
+    node_ptr pool = nullptr;
+    try {
+      copy_node(root, other.root, nullptr, pool);
+    } catch (...) {
+      clear();
+      throw;
+    }
   }
 
   RBTree(const std::initializer_list<value_type>& ilist)
-      : root{nullptr}, alloc{}, comp{} {
+      : root{nullptr}, alloc{}, comp{}, filter{} {
     for (auto i : ilist) insert(i);
   }
 
   RBTree(RBTree&& other) noexcept
       : root{std::move(other.root)},
         alloc{std::move(other.alloc)},
-        comp{std::move(other.comp)} {
+        comp{std::move(other.comp)},
+        filter{std::move(other.filter)} {
     other.root = nullptr;
+    other.filter.clear();
   }
 
+  /* Узлы текущего дерева переиспользуются: ключи и значения
+   * перезаписываются на месте, выделяются и освобождаются только
+   * недостающие и лишние узлы */
   RBTree& operator=(const RBTree& other) {
-    RBTree tmp{other};
-    std::swap(*this, tmp);
+    if (this == &other) return *this;
+
+    node_ptr pool = nullptr;
+    detach_nodes(root, pool);
+    root = nullptr;
+    comp = other.comp;
+    filter = other.filter;
+    try {
+      copy_node(root, other.root, nullptr, pool);
+    } catch (...) {
+      clear();
+      free_pool(pool);
+      throw;
+    }
+    free_pool(pool);
     return *this;
   }
 
@@ -150,7 +201,9 @@ class RBTree {
     root = other.root;
     alloc = other.alloc;
     comp = other.comp;
+    filter = std::move(other.filter);
     other.root = nullptr;
+    other.filter.clear();
     return *this;
   }
 
@@ -219,10 +272,12 @@ class RBTree {
   std::pair<iterator, bool> insert(const std::pair<const K, V>& value,
                                    bool unique = true) {
     node_ptr t = alloc.allocate(1);
-    ::new((void*)t) RBNode<K, V>(value);
+    ::new((void*)t) node_type(value);
     if (empty()) {
-      t->color = Color::BLACK;
       root = t;
+      propagate(t);
+      Balance::fixInsertion(*this, t);
+      filter_insert(t->key);
       return std::pair<iterator, bool>(iterator(t), true);
     }
     node_ptr p = root;
@@ -232,7 +287,7 @@ class RBTree {
       q = p;
 
       if (q->key == t->key && unique == true) {
-        alloc.deallocate(t, 1);
+        destroy_node(t);
         return std::pair<iterator, bool>(iterator(q), false);
       }
 
@@ -247,10 +302,22 @@ class RBTree {
       q->right = t;
     else
       q->left = t;
-    fixInsertion(t);
+    propagate(t);
+    Balance::fixInsertion(*this, t);
+    filter_insert(t->key);
     return std::pair<iterator, bool>(iterator(t), true);
   }
 
+  /* В отличие от записи через at() и operator[], обновляет свертки
+   * аугментированного дерева */
+  std::pair<iterator, bool> insert_or_assign(const K& key, const V& value) {
+    node_ptr node = findNode(key);
+    if (node == nullptr) return insert(value_type(key, value));
+    node->value = value;
+    propagate(node);
+    return std::pair<iterator, bool>(iterator(node), false);
+  }
+
   template <class... Args>
   std::vector<std::pair<iterator, bool>> emplace(Args&&... args) noexcept {
     std::vector<std::pair<iterator, bool>> res_vector;
@@ -288,7 +355,7 @@ class RBTree {
   }
 
   size_type erase(const K& key) {
-    if (empty()) return 0;
+    if (empty() || !filter.may_contain(key)) return 0;
     node_ptr tmp = root;
 
     while (tmp != nullptr && tmp->key != key) {
@@ -309,6 +376,7 @@ class RBTree {
     std::swap(root, other.root);
     std::swap(alloc, other.alloc);
     std::swap(comp, other.comp);
+    std::swap(filter, other.filter);
   }
 
   iterator find(const K& key) { return iterator(findNode(key)); }
@@ -332,16 +400,96 @@ class RBTree {
     return iterator(tmp);
   }
 
+  /* Свертка моноида Augment по всему дереву */
+  summary_type aggregate() const {
+    static_assert(!std::is_void<Augment>::value, "RBTree has no Augment");
+    return summary(root);
+  }
+
+  /* Свертка по ключам из [lo, hi) в порядке ключей, за O(log n) */
+  summary_type aggregate(const K& lo, const K& hi) const {
+    static_assert(!std::is_void<Augment>::value, "RBTree has no Augment");
+
+    // первый узел, который лежит в диапазоне: дальше пути к lo и hi расходятся
+    node_ptr node = root;
+    while (node != nullptr) {
+      if (comp(node->key, lo))
+        node = node->right;
+      else if (!comp(node->key, hi))
+        node = node->left;
+      else
+        break;
+    }
+    if (node == nullptr) return Augment::identity();
+
+    // ключи >= lo в левом поддереве, собираем справа налево
+    summary_type left = Augment::identity();
+    for (node_ptr n = node->left; n != nullptr;) {
+      if (comp(n->key, lo)) {
+        n = n->right;
+      } else {
+        left = Augment::combine(Augment::combine(lift(n), summary(n->right)),
+                                left);
+        n = n->left;
+      }
+    }
+
+    // ключи < hi в правом поддереве, собираем слева направо
+    summary_type right = Augment::identity();
+    for (node_ptr n = node->right; n != nullptr;) {
+      if (!comp(n->key, hi)) {
+        n = n->left;
+      } else {
+        right = Augment::combine(right,
+                                 Augment::combine(summary(n->left), lift(n)));
+        n = n->right;
+      }
+    }
+
+    return Augment::combine(Augment::combine(left, lift(node)), right);
+  }
+
   bool empty() const noexcept { return root == nullptr; }
 
   size_type size() const noexcept { return count_size(root); }
 
+  /* Только для TreapBalance: ключи не меньше key переносятся в
+   * возвращаемое дерево */
+  RBTree split(const K& key) {
+    RBTree rest;
+    rest.alloc = alloc;
+    rest.comp = comp;
+    node_ptr l, r;
+    Balance::split(*this, root, key, l, r);
+    root = l;
+    rest.root = r;
+    if (root != nullptr) root->parent = nullptr;
+    if (rest.root != nullptr) rest.root->parent = nullptr;
+    rebuild_filter();
+    rest.rebuild_filter();
+    return rest;
+  }
+
+  /* Только для TreapBalance: переносит все ключи other, не меньшие ключей
+   * дерева, в конец дерева; иначе std::invalid_argument */
+  void join(RBTree& other) {
+    if (this == &other || other.root == nullptr) return;
+    if (root != nullptr && comp(other.root->min()->key, root->max()->key))
+      throw std::invalid_argument("RBTree::join: ranges overlap");
+    root = Balance::join(*this, root, other.root);
+    root->parent = nullptr;
+    other.root = nullptr;
+    other.filter.clear();
+    rebuild_filter();
+  }
+
   void clear() noexcept {
     delete_node(root);
     root = nullptr;
+    filter.clear();
   }
 
-  node_ptr get_root() { return root; }
+  node_ptr get_root() const { return root; }
 
   int rb_assert(node_ptr rut, bool unique = true) {
     if (rut == NULL)
@@ -352,8 +500,8 @@ class RBTree {
       node_ptr rn = rut->right;
 
       /* Consecutive red links */
-      if (isRed(rut)) {
-        if (isRed(ln) || isRed(ln)) {
+      if (RBBalance::isRed(rut)) {
+        if (RBBalance::isRed(ln) || RBBalance::isRed(rn)) {
           std::cout << "Red violation";
           return 0;
         }
@@ -385,12 +533,15 @@ class RBTree {
 
       /* Only count black links */
       if (lh != 0 && rh != 0)
-        return isRed(rut) ? lh : lh + 1;
+        return RBBalance::isRed(rut) ? lh : lh + 1;
       else
         return 0;
     }
   }
 
+  /* Проверяет инвариант политики балансировки */
+  bool is_balanced() const { return Balance::verify(root) >= 0; }
+
  private:
   void rotateLeft(node_ptr node) {
     node_ptr base = node->right;
@@ -410,6 +561,9 @@ class RBTree {
     base->left = node;
 
     if (node == root) root = base;
+
+    update(node);
+    update(base);
   }
 
   void rotateRight(node_ptr node) {
@@ -430,216 +584,73 @@ class RBTree {
     base->right = node;
 
     if (node == root) root = base;
-  }
 
-  void fixInsertion(node_ptr node) {
-    if (node == root) {
-      node->color = Color::BLACK;
-      return;
-    }
-
-    // если отец node - черный, никакое свойство дерева не нарушено
-    // если красный - нарушается (3)
-    while (node->parent && node->parent->color == Color::RED) {
-      node_ptr gran = grandparent(node);
-      node_ptr uncl = uncle(node);
-
-      // достаточно рассмотреть 2 случая
-      // 1: дядя node тоже красный
-      if (gran) {
-        // если отец - левый ребенок
-        if (gran->left == node->parent) {
-          // если есть красный дядя справа
-          if (uncl != nullptr && uncl->color == Color::RED) {
-            // перекрашиваем отца и дядю в черный цвет, а деда - в красный, node
-            // переносим на деда
-            node->parent->color = Color::BLACK;
-            uncl->color = Color::BLACK;
-            gran->color = Color::RED;
-            node = gran;
-          } else {  // нет дяди
-            // если node - правый сын
-            if (node->parent->right == node) {
-              node = node->parent;
-              rotateLeft(node);
-            }
-            node->parent->color = Color::BLACK;
-            gran->color = Color::RED;
-            rotateRight(gran);
-          }
-          // отец - правый ребенок
-        } else {
-          // если есть красный дядя слева
-          if (uncl && uncl->color == Color::RED) {
-            node->parent->color = Color::BLACK;
-            uncl->color = Color::BLACK;
-            gran->color = Color::RED;
-            node = gran;
-          } else {  // нет дяди
-            // если node - левый сын
-            if (node->parent->left == node) {
-              node = node->parent;
-              rotateRight(node);
-            }
-            node->parent->color = Color::BLACK;
-            gran->color = Color::RED;
-            rotateLeft(gran);
-          }
-        }
-      }
-    }
-    // корень всегда черный; если node был корнем, то в цикл не зашли и сразу
-    // попали сюда
-    root->color = Color::BLACK;
+    update(node);
+    update(base);
   }
 
-  /* 1. RED node, 2 children --> RED node, 0||1 child
-   * 2. BLACK node, 2 children --> BLACK node, 0||1 child
-   * 3. RED node, 1 child --> doesn't exist
-   * 4. BLACK node, 1 child --> свапаем с красным ребенком и удаляем ребенка
-   * 5. RED node, 0 child --> удаляем node, указатель у родителя - nullptr
-   * 6. BLACK node, 0 child --> удаляем node, указатель у родителя - nullptr
-   *
-   *  Если удаляемый элемент был черным - нужна балансировка
+  /* Политика может сама опустить узел (treap); иначе узел с двумя детьми
+   * меняется данными с минимумом правого поддерева. После этого вырезается
+   * узел, у которого не больше одного ребенка: его место занимает ребенок,
+   * а политика восстанавливает баланс
    */
   void removeNode(node_ptr node) {
-    // case 5 && 6
-    if (noChildren(node)) {
-      if (node->color == Color::BLACK) fixDeleting(node);
-
-      if (node->parent == nullptr)
-        root = nullptr;
-      else if (node->parent->left == node) {
-        node->parent->left = nullptr;
-      } else {
-        node->parent->right = nullptr;
-      }
-
-      alloc.deallocate(node, 1);
-
-    }
+    Balance::beforeRemove(*this, node);
 
-    // case 3 && 4
-    else if (oneChild(node)) {
-      // это может быть только черный элемент с красным ребенком без детей
-      node_ptr child = node->left == nullptr ? node->right : node->left;
-
-      node->key = child->key;
-      node->value = child->value;
-
-      if (child == node->left)
-        node->left = nullptr;
-      else
-        node->right = nullptr;
-
-      alloc.deallocate(child, 1);
-      // балансировку делать не нужно, т.к. child точно красный
-    }
-
-    // case 1 && 2
-    else {
+    if (node->left != nullptr && node->right != nullptr) {
       node_ptr rMin = rightMin(node);
 
       node->key = rMin->key;
       node->value = rMin->value;
+      propagate(node);
 
-      removeNode(rMin);
+      node = rMin;
     }
-  }
 
-  void fixDeleting(node_ptr x) {
-    node_ptr sibling;
-    while (x != root && isBlack(x)) {
-      if (x == x->parent->left) {
-        sibling = x->parent->right;
-        if (isRed(sibling)) {
-          // case 3.1
-          sibling->color = Color::BLACK;
-          x->parent->color = Color::RED;
-          rotateLeft(x->parent);
-          sibling = x->parent->right;
-        }
+    Balance::beforeUnlink(*this, node);
 
-        if (isBlack(sibling) && isBlack(sibling->left) &&
-            isBlack(sibling->right)) {
-          // case 3.2
-          sibling->color = Color::RED;
-          x = x->parent;
-        } else {
-          if (isBlack(sibling->right)) {
-            // case 3.3
-            sibling->left->color = Color::BLACK;
-            sibling->color = Color::RED;
-            rotateRight(sibling);
-            sibling = x->parent->right;
-          }
-
-          // case 3.4
-          sibling->color = x->parent->color;
-          x->parent->color = Color::BLACK;
-          sibling->right->color = Color::BLACK;
-          rotateLeft(x->parent);
-          x = root;
-        }
-      } else {
-        sibling = x->parent->left;
-        if (isRed(sibling)) {
-          // case 3.1
-          sibling->color = Color::BLACK;
-          x->parent->color = Color::RED;
-          rotateRight(x->parent);
-          sibling = x->parent->left;
-        }
+    node_ptr child = node->left == nullptr ? node->right : node->left;
+    node_ptr parent = node->parent;
+    bool wasLeft = parent != nullptr && parent->left == node;
 
-        if (isBlack(sibling) && isBlack(sibling->left) &&
-            isBlack(sibling->right)) {
-          // case 3.2
-          sibling->color = Color::RED;
-          x = x->parent;
-        } else {
-          if (isBlack(sibling->left)) {
-            // case 3.3
-            sibling->right->color = Color::BLACK;
-            sibling->color = Color::RED;
-            rotateLeft(sibling);
-            sibling = x->parent->left;
-          }
-
-          // case 3.4
-          sibling->color = x->parent->color;
-          x->parent->color = Color::BLACK;
-          sibling->left->color = Color::BLACK;
-          rotateRight(x->parent);
-          x = root;
-        }
-      }
-    }
-    x->color = Color::BLACK;
-  }
+    if (child != nullptr) child->parent = parent;
+    if (parent == nullptr)
+      root = child;
+    else if (wasLeft)
+      parent->left = child;
+    else
+      parent->right = child;
+    propagate(parent);
 
-  node_ptr grandparent(node_ptr n) {
-    if (n != nullptr && n->parent != nullptr) return n->parent->parent;
+    Balance::afterUnlink(*this, parent, child, wasLeft);
 
-    return nullptr;
+    destroy_node(node);
+
+    filter.erase();
+    if (filter.needs_rebuild()) rebuild_filter();
   }
 
-  node_ptr uncle(node_ptr n) {
-    node_ptr grandpa = grandparent(n);
-    if (nullptr == grandpa)  // no grandparent = no uncle
-      return nullptr;
-    if (n->parent == grandpa->left)
-      return grandpa->right;
-    else
-      return grandpa->left;
+  static summary_type summary(node_ptr node) {
+    if (node == nullptr) return Augment::identity();
+    return node->summary;
   }
 
-  bool noChildren(node_ptr node) {
-    return node->left == nullptr && node->right == nullptr;
+  static summary_type lift(node_ptr node) {
+    return Augment::lift(node->key, node->value);
   }
 
-  bool oneChild(node_ptr node) {
-    return (node->left == nullptr && node->right != nullptr) ||
-           (node->left != nullptr && node->right == nullptr);
+  // пересчитывает свертку node по детям
+  void update(node_ptr node) {
+    if constexpr (!std::is_void<Augment>::value)
+      node->summary = Augment::combine(
+          Augment::combine(summary(node->left), lift(node)),
+          summary(node->right));
+  }
+
+  // пересчитывает свертки на пути от node до корня
+  void propagate(node_ptr node) {
+    if constexpr (!std::is_void<Augment>::value)
+      for (; node != nullptr; node = node->parent) update(node);
   }
 
   node_ptr rightMin(node_ptr node) {
@@ -654,18 +665,6 @@ class RBTree {
     return ret;
   }
 
-  bool isRed(node_ptr node) {
-    return node != nullptr && node->color == Color::RED;
-  }
-
-  bool isBlack(node_ptr node) {
-    return node == nullptr || node->color == Color::BLACK;
-  }
-
-  bool oneChildRed(node_ptr node) {
-    return isRed(node->left) || isRed(node->right);
-  }
-
   void printHelper(node_ptr root, std::string indent, bool last) {
     if (root != nullptr) {
       std::cout << indent;
@@ -684,15 +683,62 @@ class RBTree {
     }
   }
 
-  node_ptr copy_node(node_ptr src_node, node_ptr parent) {
-    if (src_node == nullptr) return nullptr;
+  // копирует поддерево src_node в slot, беря узлы из pool, пока он не
+  // пуст; узел подвешивается до присваивания и копирования детей, так что
+  // при исключении скопированная часть остается в дереве и освобождается
+  // clear()
+  void copy_node(node_ptr& slot, node_ptr src_node, node_ptr parent,
+                 node_ptr& pool) {
+    if (src_node == nullptr) return;
+
+    node_ptr new_node;
+    if (pool != nullptr) {
+      new_node = pool;
+      pool = pool->left;
+      link_copy(slot, new_node, parent);
+      new_node->key = src_node->key;
+      new_node->value = src_node->value;
+    } else {
+      new_node = alloc.allocate(1);
+      try {
+        ::new((void*)new_node)
+            node_type(src_node->key, src_node->value, src_node->color);
+      } catch (...) {
+        alloc.deallocate(new_node, 1);
+        throw;
+      }
+      link_copy(slot, new_node, parent);
+    }
+    new_node->color = src_node->color;
+    new_node->rank = src_node->rank;
+
+    copy_node(new_node->left, src_node->left, new_node, pool);
+    copy_node(new_node->right, src_node->right, new_node, pool);
+    update(new_node);
+  }
 
-    node_ptr new_node = alloc.allocate(1);
-    ::new((void*)new_node) RBNode<K, V>{src_node->key, src_node->value, src_node->color};
-    new_node->parent = parent;
-    new_node->left = copy_node(src_node->left, new_node);
-    new_node->right = copy_node(src_node->right, new_node);
-    return new_node;
+  static void link_copy(node_ptr& slot, node_ptr node, node_ptr parent) {
+    node->parent = parent;
+    node->left = nullptr;
+    node->right = nullptr;
+    slot = node;
+  }
+
+  // нанизывает узлы поддерева на список через left
+  static void detach_nodes(node_ptr node, node_ptr& pool) {
+    if (node == nullptr) return;
+    detach_nodes(node->left, pool);
+    detach_nodes(node->right, pool);
+    node->left = pool;
+    pool = node;
+  }
+
+  void free_pool(node_ptr pool) {
+    while (pool != nullptr) {
+      node_ptr next = pool->left;
+      destroy_node(pool);
+      pool = next;
+    }
   }
 
   void delete_node(node_ptr start) {
@@ -701,7 +747,12 @@ class RBTree {
     delete_node(start->left);
     delete_node(start->right);
 
-    alloc.deallocate(start, 1);
+    destroy_node(start);
+  }
+
+  void destroy_node(node_ptr node) {
+    std::allocator_traits<node_allocator>::destroy(alloc, node);
+    alloc.deallocate(node, 1);
   }
 
   size_type count_size(node_ptr rut) const {
@@ -714,8 +765,22 @@ class RBTree {
     return sz;
   }
 
-  node_ptr findNode(const K& key) {
-    if (empty()) return nullptr;
+  void filter_insert(const K& key) {
+    filter.insert(key);
+    if (filter.needs_rebuild()) rebuild_filter();
+  }
+
+  // фильтр не умеет удалять ключи: собираем его заново по всему дереву
+  void rebuild_filter() {
+    if constexpr (std::is_same<Filter, NoFilter>::value) return;
+    if (root == nullptr) return filter.clear();
+    filter.reset(size());
+    for (node_ptr node = root->min(); node != nullptr; node = node->successor())
+      filter.insert(node->key);
+  }
+
+  node_ptr findNode(const K& key) const {
+    if (empty() || !filter.may_contain(key)) return nullptr;
 
     node_ptr tmp = root;
     while (tmp != nullptr && tmp->key != key) {
@@ -0,0 +1,70 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_TREE_AUGMENT_H_
+#define _STL_CONTAINERS_CONTAINERS_TREE_AUGMENT_H_
+
+#include <algorithm>
+#include <limits>
+
+/* Аугментация RBTree: каждый узел хранит свертку моноида по своему
+ * поддереву, дерево пересчитывает ее при вставке, удалении и поворотах.
+ * Моноид задается структурой
+ *
+ *   typedef X value_type;
+ *   static X identity();
+ *   static X combine(const X& a, const X& b);   // ассоциативна
+ *   static X lift(const K& key, const V& value);
+ *
+ * combine может быть некоммутативной: аргументы идут в порядке ключей.
+ */
+
+template <class Augment>
+struct RBNodeSummary {
+  typename Augment::value_type summary;
+};
+
+template <>
+struct RBNodeSummary<void> {};
+
+template <class Augment>
+struct AugmentTraits {
+  typedef typename Augment::value_type value_type;
+};
+
+template <>
+struct AugmentTraits<void> {
+  typedef void value_type;
+};
+
+template <class T>
+struct SumAugment {
+  typedef T value_type;
+  static T identity() { return T(); }
+  static T combine(const T& a, const T& b) { return a + b; }
+  template <class K>
+  static T lift(const K&, const T& value) {
+    return value;
+  }
+};
+
+template <class T>
+struct MinAugment {
+  typedef T value_type;
+  static T identity() { return std::numeric_limits<T>::max(); }
+  static T combine(const T& a, const T& b) { return std::min(a, b); }
+  template <class K>
+  static T lift(const K&, const T& value) {
+    return value;
+  }
+};
+
+template <class T>
+struct MaxAugment {
+  typedef T value_type;
+  static T identity() { return std::numeric_limits<T>::lowest(); }
+  static T combine(const T& a, const T& b) { return std::max(a, b); }
+  template <class K>
+  static T lift(const K&, const T& value) {
+    return value;
+  }
+};
+
+#endif  // _STL_CONTAINERS_CONTAINERS_TREE_AUGMENT_H_
@@ -0,0 +1,544 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_TREE_BALANCE_H_
+#define _STL_CONTAINERS_CONTAINERS_TREE_BALANCE_H_
+
+#include <algorithm>
+#include <cstdint>
+
+/* Политики балансировки для RBTree.
+ *
+ * Дерево само вставляет узел как в обычное поисковое дерево и само вырезает
+ * узел, у которого не больше одного ребенка; политика только восстанавливает
+ * баланс поворотами дерева (rotateLeft/rotateRight) и своими метаданными в
+ * узле (color, rank):
+ *
+ *   fixInsertion(tree, node)                   - node только что подвешен
+ *   beforeRemove(tree, node)                   - node удаляют, у него могут
+ *                                                быть оба ребенка
+ *   beforeUnlink(tree, node)                   - node сейчас будет вырезан
+ *   afterUnlink(tree, parent, child, wasLeft)  - child встал на место узла
+ *   verify(root)                               - высота дерева или -1
+ */
+
+enum class Color { RED, BLACK };
+
+/* Красно-чёрное дерево: дешевые вставки и удаления, глубина до 2 log n */
+struct RBBalance {
+  template <class Tree, class Node>
+  static void fixInsertion(Tree& t, Node* node) {
+    if (node == t.root) {
+      node->color = Color::BLACK;
+      return;
+    }
+
+    // если отец node - черный, никакое свойство дерева не нарушено
+    // если красный - нарушается (3)
+    while (node->parent && node->parent->color == Color::RED) {
+      Node* gran = grandparent(node);
+      Node* uncl = uncle(node);
+
+      // достаточно рассмотреть 2 случая
+      // 1: дядя node тоже красный
+      if (gran) {
+        // если отец - левый ребенок
+        if (gran->left == node->parent) {
+          // если есть красный дядя справа
+          if (uncl != nullptr && uncl->color == Color::RED) {
+            // перекрашиваем отца и дядю в черный цвет, а деда - в красный, node
+            // переносим на деда
+            node->parent->color = Color::BLACK;
+            uncl->color = Color::BLACK;
+            gran->color = Color::RED;
+            node = gran;
+          } else {  // нет дяди
+            // если node - правый сын
+            if (node->parent->right == node) {
+              node = node->parent;
+              t.rotateLeft(node);
+            }
+            node->parent->color = Color::BLACK;
+            gran->color = Color::RED;
+            t.rotateRight(gran);
+          }
+          // отец - правый ребенок
+        } else {
+          // если есть красный дядя слева
+          if (uncl && uncl->color == Color::RED) {
+            node->parent->color = Color::BLACK;
+            uncl->color = Color::BLACK;
+            gran->color = Color::RED;
+            node = gran;
+          } else {  // нет дяди
+            // если node - левый сын
+            if (node->parent->left == node) {
+              node = node->parent;
+              t.rotateRight(node);
+            }
+            node->parent->color = Color::BLACK;
+            gran->color = Color::RED;
+            t.rotateLeft(gran);
+          }
+        }
+      }
+    }
+    // корень всегда черный; если node был корнем, то в цикл не зашли и сразу
+    // попали сюда
+    t.root->color = Color::BLACK;
+  }
+
+  template <class Tree, class Node>
+  static void beforeRemove(Tree&, Node*) {}
+
+  /* 1. RED node, 0 child --> удаляем node, балансировка не нужна
+   * 2. BLACK node, 1 child --> ребенок точно красный, перекрашиваем его в
+   *    черный после вырезания
+   * 3. BLACK node, 0 child --> балансируем, пока node еще в дереве
+   */
+  template <class Tree, class Node>
+  static void beforeUnlink(Tree& t, Node* node) {
+    if (node->left == nullptr && node->right == nullptr &&
+        node->color == Color::BLACK)
+      fixDeleting(t, node);
+  }
+
+  template <class Tree, class Node>
+  static void afterUnlink(Tree&, Node*, Node* child, bool) {
+    if (child != nullptr) child->color = Color::BLACK;
+  }
+
+  template <class Node>
+  static int verify(Node* node) {
+    if (node == nullptr) return 0;
+    if (isRed(node) && (isRed(node->left) || isRed(node->right))) return -1;
+    int lh = verify(node->left);
+    int rh = verify(node->right);
+    if (lh < 0 || rh < 0 || lh != rh) return -1;
+    return isRed(node) ? lh : lh + 1;
+  }
+
+  template <class Node>
+  static bool isRed(Node* node) {
+    return node != nullptr && node->color == Color::RED;
+  }
+
+  template <class Node>
+  static bool isBlack(Node* node) {
+    return node == nullptr || node->color == Color::BLACK;
+  }
+
+ private:
+  template <class Tree, class Node>
+  static void fixDeleting(Tree& t, Node* x) {
+    Node* sibling;
+    while (x != t.root && isBlack(x)) {
+      if (x == x->parent->left) {
+        sibling = x->parent->right;
+        if (isRed(sibling)) {
+          // case 3.1
+          sibling->color = Color::BLACK;
+          x->parent->color = Color::RED;
+          t.rotateLeft(x->parent);
+          sibling = x->parent->right;
+        }
+
+        if (isBlack(sibling) && isBlack(sibling->left) &&
+            isBlack(sibling->right)) {
+          // case 3.2
+          sibling->color = Color::RED;
+          x = x->parent;
+        } else {
+          if (isBlack(sibling->right)) {
+            // case 3.3
+            sibling->left->color = Color::BLACK;
+            sibling->color = Color::RED;
+            t.rotateRight(sibling);
+            sibling = x->parent->right;
+          }
+
+          // case 3.4
+          sibling->color = x->parent->color;
+          x->parent->color = Color::BLACK;
+          sibling->right->color = Color::BLACK;
+          t.rotateLeft(x->parent);
+          x = t.root;
+        }
+      } else {
+        sibling = x->parent->left;
+        if (isRed(sibling)) {
+          // case 3.1
+          sibling->color = Color::BLACK;
+          x->parent->color = Color::RED;
+          t.rotateRight(x->parent);
+          sibling = x->parent->left;
+        }
+
+        if (isBlack(sibling) && isBlack(sibling->left) &&
+            isBlack(sibling->right)) {
+          // case 3.2
+          sibling->color = Color::RED;
+          x = x->parent;
+        } else {
+          if (isBlack(sibling->left)) {
+            // case 3.3
+            sibling->right->color = Color::BLACK;
+            sibling->color = Color::RED;
+            t.rotateLeft(sibling);
+            sibling = x->parent->left;
+          }
+
+          // case 3.4
+          sibling->color = x->parent->color;
+          x->parent->color = Color::BLACK;
+          sibling->left->color = Color::BLACK;
+          t.rotateRight(x->parent);
+          x = t.root;
+        }
+      }
+    }
+    x->color = Color::BLACK;
+  }
+
+  template <class Node>
+  static Node* grandparent(Node* n) {
+    if (n != nullptr && n->parent != nullptr) return n->parent->parent;
+
+    return nullptr;
+  }
+
+  template <class Node>
+  static Node* uncle(Node* n) {
+    Node* grandpa = grandparent(n);
+    if (nullptr == grandpa)  // no grandparent = no uncle
+      return nullptr;
+    if (n->parent == grandpa->left)
+      return grandpa->right;
+    else
+      return grandpa->left;
+  }
+};
+
+/* AVL-дерево: высоты поддеревьев отличаются не больше чем на 1, глубина до
+ * 1.44 log n - для деревьев, которые в основном читают. rank - высота узла,
+ * у листа 0, у пустого поддерева -1.
+ */
+struct AVLBalance {
+  template <class Tree, class Node>
+  static void fixInsertion(Tree& t, Node* node) {
+    node->rank = 0;
+    retrace(t, node->parent);
+  }
+
+  template <class Tree, class Node>
+  static void beforeRemove(Tree&, Node*) {}
+
+  template <class Tree, class Node>
+  static void beforeUnlink(Tree&, Node*) {}
+
+  template <class Tree, class Node>
+  static void afterUnlink(Tree& t, Node* parent, Node*, bool) {
+    retrace(t, parent);
+  }
+
+  template <class Node>
+  static int verify(Node* node) {
+    if (node == nullptr) return 0;
+    int lh = verify(node->left);
+    int rh = verify(node->right);
+    if (lh < 0 || rh < 0 || lh - rh > 1 || rh - lh > 1) return -1;
+    if (node->rank != std::max(lh, rh)) return -1;
+    return std::max(lh, rh) + 1;
+  }
+
+ private:
+  template <class Node>
+  static int height(Node* n) {
+    return n == nullptr ? -1 : n->rank;
+  }
+
+  template <class Node>
+  static void update(Node* n) {
+    n->rank = 1 + std::max(height(n->left), height(n->right));
+  }
+
+  // поднимаемся к корню, пока высота поддерева меняется
+  template <class Tree, class Node>
+  static void retrace(Tree& t, Node* n) {
+    while (n != nullptr) {
+      int old = n->rank;
+      n = rebalance(t, n);
+      if (n->rank == old) return;
+      n = n->parent;
+    }
+  }
+
+  // возвращает новый корень поддерева n
+  template <class Tree, class Node>
+  static Node* rebalance(Tree& t, Node* n) {
+    int balance = height(n->left) - height(n->right);
+    if (balance > 1) {
+      if (height(n->left->left) < height(n->left->right))
+        rotateLeft(t, n->left);
+      return rotateRight(t, n);
+    }
+    if (balance < -1) {
+      if (height(n->right->right) < height(n->right->left))
+        rotateRight(t, n->right);
+      return rotateLeft(t, n);
+    }
+    update(n);
+    return n;
+  }
+
+  template <class Tree, class Node>
+  static Node* rotateLeft(Tree& t, Node* n) {
+    Node* base = n->right;
+    t.rotateLeft(n);
+    update(n);
+    update(base);
+    return base;
+  }
+
+  template <class Tree, class Node>
+  static Node* rotateRight(Tree& t, Node* n) {
+    Node* base = n->left;
+    t.rotateRight(n);
+    update(n);
+    update(base);
+    return base;
+  }
+};
+
+/* Weak AVL (Haeupler, Sen, Tarjan): ранговые разности 1 или 2, у листа ранг
+ * 0. Вставка делает не больше двух поворотов, как в красно-чёрном дереве,
+ * а без удалений дерево остается AVL-деревом.
+ */
+struct WAVLBalance {
+  template <class Tree, class Node>
+  static void fixInsertion(Tree& t, Node* x) {
+    x->rank = 0;
+    // x - 0-ребенок, пока его ранг совпадает с рангом отца
+    while (x->parent != nullptr && x->parent->rank == x->rank) {
+      Node* p = x->parent;
+      bool left = p->left == x;
+      Node* s = left ? p->right : p->left;
+
+      // 0,1 - повышаем отца и поднимаемся
+      if (p->rank - rank(s) == 1) {
+        ++p->rank;
+        x = p;
+        continue;
+      }
+
+      // 0,2 - поворот
+      Node* y = left ? x->right : x->left;
+      if (y == nullptr || x->rank - y->rank == 2) {
+        if (left)
+          t.rotateRight(p);
+        else
+          t.rotateLeft(p);
+        --p->rank;
+      } else {
+        if (left) {
+          t.rotateLeft(x);
+          t.rotateRight(p);
+        } else {
+          t.rotateRight(x);
+          t.rotateLeft(p);
+        }
+        ++y->rank;
+        --x->rank;
+        --p->rank;
+      }
+      return;
+    }
+  }
+
+  template <class Tree, class Node>
+  static void beforeRemove(Tree&, Node*) {}
+
+  template <class Tree, class Node>
+  static void beforeUnlink(Tree&, Node*) {}
+
+  template <class Tree, class Node>
+  static void afterUnlink(Tree& t, Node* x, Node* y, bool wasLeft) {
+    if (x == nullptr) return;
+
+    // x мог стать листом ранга 1 (2,2-лист)
+    if (x->left == nullptr && x->right == nullptr && x->rank == 1) {
+      x->rank = 0;
+      y = x;
+      x = x->parent;
+      if (x != nullptr) wasLeft = x->left == y;
+    }
+
+    // y - 3-ребенок x
+    while (x != nullptr && x->rank - rank(y) == 3) {
+      Node* s = wasLeft ? x->right : x->left;
+
+      if (x->rank - rank(s) == 2) {
+        --x->rank;
+      } else if (s->rank - rank(s->left) == 2 &&
+                 s->rank - rank(s->right) == 2) {
+        --x->rank;
+        --s->rank;
+      } else {
+        rotateDeleted(t, x, s, wasLeft);
+        return;
+      }
+
+      y = x;
+      x = x->parent;
+      if (x != nullptr) wasLeft = x->left == y;
+    }
+  }
+
+  template <class Node>
+  static int verify(Node* node) {
+    if (node == nullptr) return 0;
+    if (node->left == nullptr && node->right == nullptr && node->rank != 0)
+      return -1;
+    int ld = node->rank - rank(node->left);
+    int rd = node->rank - rank(node->right);
+    if (ld < 1 || ld > 2 || rd < 1 || rd > 2) return -1;
+    int lh = verify(node->left);
+    int rh = verify(node->right);
+    if (lh < 0 || rh < 0) return -1;
+    return std::max(lh, rh) + 1;
+  }
+
+ private:
+  template <class Node>
+  static int rank(Node* n) {
+    return n == nullptr ? -1 : n->rank;
+  }
+
+  // s - 1-ребенок x, и хотя бы один ребенок s - 1-ребенок
+  template <class Tree, class Node>
+  static void rotateDeleted(Tree& t, Node* x, Node* s, bool wasLeft) {
+    Node* inner = wasLeft ? s->left : s->right;
+    Node* outer = wasLeft ? s->right : s->left;
+
+    if (s->rank - rank(outer) == 1) {
+      if (wasLeft)
+        t.rotateLeft(x);
+      else
+        t.rotateRight(x);
+      ++s->rank;
+      --x->rank;
+      if (x->left == nullptr && x->right == nullptr) --x->rank;
+    } else {
+      if (wasLeft) {
+        t.rotateRight(s);
+        t.rotateLeft(x);
+      } else {
+        t.rotateLeft(s);
+        t.rotateRight(x);
+      }
+      inner->rank += 2;
+      x->rank -= 2;
+      --s->rank;
+    }
+  }
+};
+
+/* Декартово дерево (treap): rank - случайный приоритет, отец не меньше
+ * детей. Удаляемый узел опускается до листа или узла с одним ребенком и
+ * вырезается сам, так что ключ не наследует чужой приоритет. Только с этой
+ * политикой у дерева есть split/join за ожидаемые O(log n).
+ */
+struct TreapBalance {
+  /* Разрезает поддерево n: ключи меньше key уходят в l, остальные в r */
+  template <class Tree, class Node, class K>
+  static void split(Tree& t, Node* n, const K& key, Node*& l, Node*& r) {
+    if (n == nullptr) {
+      l = r = nullptr;
+      return;
+    }
+    if (t.comp(n->key, key)) {
+      split(t, n->right, key, n->right, r);
+      setParent(n->right, n);
+      l = n;
+    } else {
+      split(t, n->left, key, l, n->left);
+      setParent(n->left, n);
+      r = n;
+    }
+    t.update(n);
+  }
+
+  /* Сливает поддеревья, все ключи a не больше ключей b; возвращает корень */
+  template <class Tree, class Node>
+  static Node* join(Tree& t, Node* a, Node* b) {
+    if (a == nullptr) return b;
+    if (b == nullptr) return a;
+    if (a->rank > b->rank) {
+      a->right = join(t, a->right, b);
+      a->right->parent = a;
+      t.update(a);
+      return a;
+    }
+    b->left = join(t, a, b->left);
+    b->left->parent = b;
+    t.update(b);
+    return b;
+  }
+
+  template <class Tree, class Node>
+  static void fixInsertion(Tree& t, Node* node) {
+    node->rank = priority();
+    while (node->parent != nullptr && node->parent->rank < node->rank) {
+      if (node->parent->left == node)
+        t.rotateRight(node->parent);
+      else
+        t.rotateLeft(node->parent);
+    }
+  }
+
+  /* Опускает node поворотами к ребенку с большим приоритетом, пока у него
+   * не останется одного ребенка: дерево вырежет сам node, и приоритеты
+   * остальных ключей не поменяются
+   */
+  template <class Tree, class Node>
+  static void beforeRemove(Tree& t, Node* node) {
+    while (node->left != nullptr && node->right != nullptr) {
+      if (node->left->rank > node->right->rank)
+        t.rotateRight(node);
+      else
+        t.rotateLeft(node);
+    }
+  }
+
+  template <class Tree, class Node>
+  static void beforeUnlink(Tree&, Node*) {}
+
+  template <class Tree, class Node>
+  static void afterUnlink(Tree&, Node*, Node*, bool) {}
+
+  template <class Node>
+  static int verify(Node* node) {
+    if (node == nullptr) return 0;
+    if ((node->left != nullptr && node->left->rank > node->rank) ||
+        (node->right != nullptr && node->right->rank > node->rank))
+      return -1;
+    int lh = verify(node->left);
+    int rh = verify(node->right);
+    if (lh < 0 || rh < 0) return -1;
+    return std::max(lh, rh) + 1;
+  }
+
+ private:
+  template <class Node>
+  static void setParent(Node* child, Node* parent) {
+    if (child != nullptr) child->parent = parent;
+  }
+
+  // xorshift32, по своему состоянию на поток
+  static int priority() {
+    static thread_local std::uint32_t state = 2463534242u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<int>(state >> 1);
+  }
+};
+
+#endif  // _STL_CONTAINERS_CONTAINERS_TREE_BALANCE_H_
@@ -0,0 +1,128 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_TREE_FILTER_H_
+#define _STL_CONTAINERS_CONTAINERS_TREE_FILTER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "vector.h"
+
+/* Фильтр перед поиском в RBTree: если фильтр говорит, что ключа нет, дерево
+ * не спускается. Политика задается структурой
+ *
+ *   void insert(const K& key);         // ключ добавлен в дерево
+ *   bool may_contain(const K& key) const;  // false - ключа точно нет
+ *   void erase();                      // из дерева удален один ключ
+ *   bool needs_rebuild() const;        // пора собрать фильтр заново
+ *   void reset(std::size_t n);         // пустой фильтр на n ключей
+ *   void clear() noexcept;             // пустой фильтр без памяти
+ *
+ * После needs_rebuild() дерево вызывает reset(size()) и заново вставляет
+ * все ключи.
+ */
+
+/* Фильтр по умолчанию: пустой, все вызовы исчезают при компиляции */
+struct NoFilter {
+  template <class K>
+  void insert(const K&) {}
+  template <class K>
+  bool may_contain(const K&) const {
+    return true;
+  }
+  void erase() {}
+  bool needs_rebuild() const { return false; }
+  void reset(std::size_t) {}
+  void clear() noexcept {}
+};
+
+/* Блочный фильтр Блума: все биты ключа лежат в одном 512-битном блоке
+ * (одна кеш-линия), по одному биту в каждом из восьми 64-битных слов.
+ * Места заложено на вдвое больше ключей, чем при последней сборке; когда
+ * ключей становится больше или удаленных больше живых, фильтр собирается
+ * заново (удалить ключ из фильтра Блума нельзя).
+ */
+template <class K, class Hash = std::hash<K>, unsigned BitsPerKey = 10>
+class BloomFilter {
+  struct alignas(64) block {
+    std::uint64_t words[8];
+  };
+
+ public:
+  static constexpr std::size_t kMinKeys = 256;
+
+  BloomFilter() : blocks{}, capacity{0}, live{0}, erased{0}, hasher{} {}
+
+  void insert(const K& key) {
+    if (blocks.empty()) reset(0);
+    std::uint64_t h = mix(hasher(key));
+    block& b = blocks[index(h)];
+    std::uint64_t g = mix(h ^ kSalt);
+    for (int i = 0; i < 8; ++i) b.words[i] |= bit(g, i);
+    ++live;
+  }
+
+  bool may_contain(const K& key) const {
+    if (blocks.empty()) return false;
+    std::uint64_t h = mix(hasher(key));
+    const block& b = blocks[index(h)];
+    std::uint64_t g = mix(h ^ kSalt);
+    std::uint64_t miss = 0;
+    for (int i = 0; i < 8; ++i) miss |= bit(g, i) & ~b.words[i];
+    return miss == 0;
+  }
+
+  void erase() {
+    --live;
+    ++erased;
+  }
+
+  bool needs_rebuild() const { return live > capacity || erased > live; }
+
+  void reset(std::size_t n) {
+    capacity = std::max(2 * n, kMinKeys);
+    std::size_t count = (capacity * BitsPerKey + 511) / 512;
+    s21::vector<block> tmp(count, block{});
+    blocks.swap(tmp);
+    live = 0;
+    erased = 0;
+  }
+
+  void clear() noexcept {
+    s21::vector<block> tmp;
+    blocks.swap(tmp);
+    capacity = 0;
+    live = 0;
+    erased = 0;
+  }
+
+ private:
+  static constexpr std::uint64_t kSalt = 0x9e3779b97f4a7c15ull;
+
+  static std::uint64_t mix(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+  }
+
+  // блок выбирается по старшим 32 битам хеша, биты в словах - по второму
+  // хешу, чтобы они не зависели от номера блока
+  std::size_t index(std::uint64_t h) const {
+    return static_cast<std::size_t>(((h >> 32) * blocks.size()) >> 32);
+  }
+
+  static std::uint64_t bit(std::uint64_t h, int i) {
+    return std::uint64_t(1) << ((h >> (6 * i)) & 63);
+  }
+
+  s21::vector<block> blocks;
+  std::size_t capacity;
+  std::size_t live;
+  std::size_t erased;
+  Hash hasher;
+};
+
+#endif  // _STL_CONTAINERS_CONTAINERS_TREE_FILTER_H_
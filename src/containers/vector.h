@@ -5,12 +5,57 @@
 #include <memory>
 #include <stdexcept>
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+#include "vector_growth.h"
 
 namespace s21 {
 
+/* A type is trivially relocatable if moving an object to a new address and
+ * forgetting the old one can be done with memcpy. That holds for every
+ * trivially copyable type and for most types that own their resources by
+ * pointer; such types opt in with a specialization:
+ *
+ *   template <> struct s21::is_trivially_relocatable<MyType>
+ *       : std::true_type {};
+ */
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+/* Detects allocators that can resize a block in place */
+template <class A, class = void>
+struct has_reallocate : std::false_type {};
+
+template <class A>
+struct has_reallocate<
+    A, std::void_t<decltype(std::declval<A&>().reallocate(
+           std::declval<typename A::value_type*>(), std::size_t(),
+           std::size_t()))>> : std::true_type {};
+
 template <typename T, typename A = std::allocator<T>>
 class vector_base {
  public:
+  /* Trivially copyable elements under the default allocator live in malloc
+   * memory, so that the buffer can grow with realloc: a large block is
+   * often extended in place or remapped by the kernel instead of copied. */
+  static constexpr bool kMalloc =
+      std::is_trivially_copyable_v<T> && std::is_same_v<A, std::allocator<T>> &&
+      alignof(T) <= alignof(std::max_align_t);
+
+  /* An allocator with reallocate(p, old_n, new_n) (e.g. mmap_allocator)
+   * resizes blocks of trivially relocatable elements the same way */
+  static constexpr bool kUseRealloc =
+      kMalloc ||
+      (has_reallocate<A>::value && is_trivially_relocatable<T>::value);
+
   T* elem;
   T* space;
   T* last;
@@ -19,7 +64,7 @@ class vector_base {
   vector_base() : elem{nullptr}, space{nullptr}, last{nullptr}, alloc{A()} {}
 
   vector_base(const A& a, typename A::size_type n) : alloc{a} {
-    elem = alloc.allocate(n);
+    elem = allocate(n);
     space = last = elem + n;
   }
 
@@ -49,13 +94,271 @@ class vector_base {
     return *this;
   }
 
-  ~vector_base() { alloc.deallocate(elem, last - elem); }
+  ~vector_base() { deallocate(alloc, elem, last - elem); }
+
+  /* Changes the capacity to n >= space - elem, keeping the elements; only
+   * for kUseRealloc */
+  void reallocate(typename A::size_type n) {
+    const std::size_t used = space - elem;
+    elem = reallocate(alloc, elem, last - elem, n);
+    space = elem + used;
+    last = elem + n;
+  }
+
+  T* allocate(typename A::size_type n) { return allocate(alloc, n); }
+
+  /* Blocks of n elements as vector_base keeps them, malloc memory for
+   * kMalloc and the allocator's otherwise; shared with s21::small_vector */
+  static T* allocate(A& a, typename A::size_type n) {
+    if constexpr (kMalloc) {
+      if (n == 0) return nullptr;
+      check_size(a, n);
+      void* p = std::malloc(n * sizeof(T));
+      if (p == nullptr) throw std::bad_alloc();
+      return static_cast<T*>(p);
+    } else {
+      return a.allocate(n);
+    }
+  }
+
+  static void deallocate(A& a, T* p, typename A::size_type n) noexcept {
+    if constexpr (kMalloc)
+      std::free(p);
+    else
+      a.deallocate(p, n);
+  }
+
+  static T* reallocate(A& a, T* p, typename A::size_type old_n,
+                       typename A::size_type n) {
+    if constexpr (!kMalloc) {
+      return a.reallocate(p, old_n, n);
+    } else if (n == 0) {
+      std::free(p);
+      return nullptr;
+    } else {
+      check_size(a, n);
+      void* q = std::realloc(p, n * sizeof(T));
+      if (q == nullptr) throw std::bad_alloc();
+      return static_cast<T*>(q);
+    }
+  }
+
+ private:
+  static void check_size(const A& a, typename A::size_type n) {
+    if (n > std::allocator_traits<A>::max_size(a))
+      throw std::length_error("vector too long");
+  }
 };
 
-template <typename T, typename A = std::allocator<T>>
+/* Element relocation and the growing insert paths, shared by s21::vector
+ * and s21::small_vector. The insert paths are templated on the container,
+ * which keeps the buffer and says how blocks come and go:
+ *
+ *   size_type recommend(size_type needed) const;  capacity to grow to
+ *   pointer allocate(size_type n);
+ *   void deallocate(pointer p, size_type n) noexcept;
+ *   void adopt(pointer b, pointer space, size_type n) noexcept;
+ *       frees the old buffer, whose elements are relocated, and takes b
+ *   bool reallocatable() const noexcept;  for kUseRealloc: whether
+ *   void reallocate(size_type n);         the buffer resizes in place
+ *   void set_size(size_type n) noexcept;
+ *   A& alloc_ref() noexcept;
+ *
+ * besides data(), size(), capacity() and max_size().
+ */
+template <class T, class A>
+struct vector_ops {
+  typedef T* pointer;
+  typedef std::size_t size_type;
+
+  static constexpr bool kUseRealloc = vector_base<T, A>::kUseRealloc;
+
+  /* Relocation that cannot fail halfway, so elements may be shifted inside
+   * the buffer without a fallback copy */
+  static constexpr bool kNothrowRelocate =
+      is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
+  static void destroy(A& alloc, pointer first, pointer last) noexcept {
+    for (; first != last; ++first)
+      std::allocator_traits<A>::destroy(alloc, first);
+  }
+
+  /* Constructs [first, last) at dest, memcpy for trivially relocatable
+   * types. A type that may throw on move is copied, so the source stays
+   * intact until destroy_relocated and on an exception dest is cleaned
+   * up. */
+  static pointer transfer(A& alloc, pointer first, pointer last,
+                          pointer dest) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+      if (first != last)
+        std::memcpy((void*)dest, (const void*)first,
+                    (last - first) * sizeof(T));
+      return dest + (last - first);
+    } else {
+      pointer out = dest;
+      try {
+        for (pointer p = first; p != last; ++p, ++out)
+          ::new ((void*)out) T(std::move_if_noexcept(*p));
+      } catch (...) {
+        destroy(alloc, dest, out);
+        throw;
+      }
+      return out;
+    }
+  }
+
+  /* Ends the lifetime of a transferred source range; memcpy already moved
+   * the objects themselves */
+  static void destroy_relocated(A& alloc, pointer first,
+                                pointer last) noexcept {
+    if constexpr (!is_trivially_relocatable_v<T>) destroy(alloc, first, last);
+  }
+
+  /* Moves [first, last) into raw storage at dest and destroys the source
+   * objects */
+  static pointer relocate(A& alloc, pointer first, pointer last,
+                          pointer dest) {
+    pointer out = transfer(alloc, first, last, dest);
+    destroy_relocated(alloc, first, last);
+    return out;
+  }
+
+  /* Moves the objects of [first, last) to start at dest inside the buffer,
+   * leaving raw storage behind; only used when kNothrowRelocate holds */
+  static void shift(A& alloc, pointer first, pointer last,
+                    pointer dest) noexcept {
+    if constexpr (is_trivially_relocatable_v<T>) {
+      if (first != last)
+        std::memmove((void*)dest, (const void*)first,
+                     (last - first) * sizeof(T));
+    } else if (dest > first) {
+      for (pointer p = last; p != first;) {
+        --p;
+        ::new ((void*)(dest + (p - first))) T(std::move(*p));
+        std::allocator_traits<A>::destroy(alloc, p);
+      }
+    } else {
+      for (pointer p = first; p != last; ++p) {
+        ::new ((void*)(dest + (p - first))) T(std::move(*p));
+        std::allocator_traits<A>::destroy(alloc, p);
+      }
+    }
+  }
+
+  /* emplace_back into a full buffer. The new element is constructed in
+   * the new buffer before the old ones move, so args may refer to them;
+   * a buffer that reallocates gets it built aside first. */
+  template <class V, class... Args>
+  static T& realloc_append(V& v, Args&&... args) {
+    const size_type sz = v.size();
+    const size_type cap = v.recommend(sz + 1);
+    if constexpr (kUseRealloc) {
+      if (v.reallocatable()) {
+        T value(std::forward<Args>(args)...);
+        v.reallocate(cap);
+        pointer slot = v.data() + sz;
+        ::new ((void*)slot) T(std::move(value));
+        v.set_size(sz + 1);
+        return *slot;
+      }
+    }
+    A& alloc = v.alloc_ref();
+    pointer b = v.allocate(cap);
+    pointer slot = b + sz;
+    try {
+      ::new ((void*)slot) T(std::forward<Args>(args)...);
+    } catch (...) {
+      v.deallocate(b, cap);
+      throw;
+    }
+    pointer old = v.data();
+    try {
+      transfer(alloc, old, old + sz, b);
+    } catch (...) {
+      std::allocator_traits<A>::destroy(alloc, slot);
+      v.deallocate(b, cap);
+      throw;
+    }
+    destroy_relocated(alloc, old, old + sz);
+    v.adopt(b, slot + 1, cap);
+    return *slot;
+  }
+
+  /* Opens a gap of count raw slots at index and lets fill construct all of
+   * them (or clean up and throw). The tail is shifted once, in place when
+   * it fits and the type relocates without throwing, otherwise everything
+   * goes into a new buffer in one allocation. Either way a throwing fill
+   * leaves the container as it was. */
+  template <class V, class Fill>
+  static void insert_gap(V& v, size_type index, size_type count, Fill fill) {
+    if (count == 0) return;
+    const size_type sz = v.size();
+    if (count > v.max_size() - sz) throw std::length_error("vector too long");
+    if constexpr (kUseRealloc)
+      if (sz + count > v.capacity() && v.reallocatable())
+        v.reallocate(v.recommend(sz + count));
+    A& alloc = v.alloc_ref();
+    if (sz + count <= v.capacity() && kNothrowRelocate) {
+      pointer gap = v.data() + index;
+      pointer end = v.data() + sz;
+      shift(alloc, gap, end, gap + count);
+      try {
+        fill(gap);
+      } catch (...) {
+        shift(alloc, gap + count, end + count, gap);
+        throw;
+      }
+      v.set_size(sz + count);
+      return;
+    }
+
+    size_type cap = v.capacity();
+    if (sz + count > cap) cap = v.recommend(sz + count);
+    pointer b = v.allocate(cap);
+    pointer gap = b + index;
+    try {
+      fill(gap);
+    } catch (...) {
+      v.deallocate(b, cap);
+      throw;
+    }
+    pointer old = v.data();
+    pointer out;
+    try {
+      pointer tail = transfer(alloc, old, old + index, b);
+      try {
+        out = transfer(alloc, old + index, old + sz, gap + count);
+      } catch (...) {
+        destroy(alloc, b, tail);
+        throw;
+      }
+    } catch (...) {
+      destroy(alloc, gap, gap + count);
+      v.deallocate(b, cap);
+      throw;
+    }
+    destroy_relocated(alloc, old, old + sz);
+    v.adopt(b, out, cap);
+  }
+};
+
+/* Growth (see vector_growth.h) picks the new capacity when push_back,
+ * insert or resize run out of room */
+template <typename T, typename A = std::allocator<T>,
+          class Growth = growth_double>
 class vector {
   vector_base<T, A> vb;
 
+  template <class It>
+  using require_input_iterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::input_iterator_tag>>;
+
+  template <class It>
+  static constexpr bool is_forward_iterator = std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::forward_iterator_tag>;
+
  public:
   typedef A allocator_type;
   typedef typename A::value_type value_type;
@@ -63,6 +366,7 @@ class vector {
   typedef typename A::const_reference const_reference;
   typedef typename A::difference_type difference_type;
   typedef typename A::size_type size_type;
+  typedef Growth growth_policy;
 
   class iterator;
   class const_iterator;
@@ -89,6 +393,26 @@ class vector {
     std::uninitialized_copy(init.begin(), init.end(), vb.elem);
   }
 
+  template <class InputIt, class = require_input_iterator<InputIt>>
+  vector(InputIt first, InputIt last, const A& a = A()) : vb() {
+    if constexpr (is_forward_iterator<InputIt>) {
+      size_type n = std::distance(first, last);
+      vector_base<T, A> b{a, n};
+      std::uninitialized_copy(first, last, b.elem);
+      std::swap(vb, b);
+    } else {
+      vb.alloc = a;
+      try {
+        for (; first != last; ++first) push_back(*first);
+      } catch (...) {
+        // ~vector does not run for a constructor that throws
+        for (pointer p = vb.elem; p != vb.space; ++p)
+          std::allocator_traits<A>::destroy(vb.alloc, p);
+        throw;
+      }
+    }
+  }
+
   ~vector() {
     for (pointer p = vb.elem; p != vb.space; ++p) 
         std::allocator_traits<A>::destroy(vb.alloc, p);
@@ -198,9 +522,13 @@ class vector {
   void reserve(size_type newalloc) {
     if (newalloc <= capacity()) return;
 
+    if constexpr (vector_base<T, A>::kUseRealloc) {
+      vb.reallocate(newalloc);
+      return;
+    }
     vector_base<T, A> b{vb.alloc, newalloc};
-    std::uninitialized_copy(vb.elem, vb.elem + size(), b.elem);
-    b.space = b.elem + size();
+    b.space = ops::relocate(vb.alloc, vb.elem, vb.space, b.elem);
+    vb.space = vb.elem;
     std::swap(vb, b);
   }
 
@@ -209,61 +537,77 @@ class vector {
   void shrink_to_fit() {
     if (!(vb.last > vb.space)) return;
 
+    if constexpr (vector_base<T, A>::kUseRealloc) {
+      vb.reallocate(size());
+      return;
+    }
     vector_base<T, A> tmp(vb.alloc, size());
-    std::uninitialized_copy(vb.elem, vb.space, tmp.elem);
+    ops::relocate(vb.alloc, vb.elem, vb.space, tmp.elem);
+    vb.space = vb.elem;
     std::swap(vb, tmp);
   }
 
   void clear() noexcept { resize(0); }
 
   iterator insert(iterator pos, const_reference value) {
-    size_type index = pos - begin();
-    if (pos < begin() || pos > end())
-      throw std::out_of_range("position is out of range");
-
-    if (size() == capacity()) reserve(size() == 0 ? 1 : size() * 2);
-
-    vector_base<T, A> tmp(vb.alloc, size() - index);
-    std::uninitialized_copy(vb.elem + index, vb.space, tmp.elem);
-    std::uninitialized_copy(tmp.elem, tmp.space, vb.elem + index + 1);
-    ::new ((void*)(vb.elem + index)) T(value);
-    /* vb.alloc.construct(vb.elem + index, value); */
-    ++vb.space;
-
-    return begin() + index;
+    return insert(pos, 1, value);
   }
 
   iterator insert(iterator pos, T&& value) {
-    size_type index = pos - begin();
-    if (pos < begin() || pos > end())
-      throw std::out_of_range("position is out of range");
-
-    if (size() == capacity()) reserve(size() == 0 ? 1 : size() * 2);
+    size_type index = check_position(pos);
+    return insert_gap(index, 1, [&](pointer gap) {
+      ::new ((void*)gap) T(std::move(value));
+    });
+  }
 
-    vector_base<T, A> tmp(vb.alloc, size() - index);
-    std::uninitialized_copy(vb.elem + index, vb.space, tmp.elem);
-    std::uninitialized_copy(tmp.elem, tmp.space, vb.elem + index + 1);
-    ::new ((void*)(vb.elem + index)) T(std::move(value));
-    /* vb.alloc.construct(vb.elem + index, std::move(value)); */
-    ++vb.space;
+  iterator insert(iterator pos, size_type count, const_reference value) {
+    size_type index = check_position(pos);
+    if (std::addressof(value) >= vb.elem && std::addressof(value) < vb.space) {
+      T copy(value);
+      return insert(pos, count, copy);
+    }
+    return insert_gap(index, count, [&](pointer gap) {
+      std::uninitialized_fill_n(gap, count, value);
+    });
+  }
 
-    return begin() + index;
+  /* Grows the storage and shifts the tail once for the whole range when
+   * its length is known up front, i.e. for forward iterators */
+  template <class InputIt, class = require_input_iterator<InputIt>>
+  iterator insert(iterator pos, InputIt first, InputIt last) {
+    size_type index = check_position(pos);
+    if constexpr (is_forward_iterator<InputIt>) {
+      size_type count = std::distance(first, last);
+      return insert_gap(index, count, [&](pointer gap) {
+        std::uninitialized_copy(first, last, gap);
+      });
+    } else {
+      size_type old_size = size();
+      for (; first != last; ++first) push_back(*first);
+      std::rotate(vb.elem + index, vb.elem + old_size, vb.space);
+      return begin() + index;
+    }
   }
 
+  /* Constructs the element from args. In the middle of the vector it is
+   * built aside and moved into the gap, since args may refer to elements
+   * that the insert shifts. */
   template <class... Args>
   iterator emplace(iterator pos, Args&&... args) {
-    if (pos > end() || pos < begin()) throw std::out_of_range("emplace");
-    iterator ret;
-    difference_type id = pos - begin();
-
-    for (auto&& item : {std::forward<Args>(args)...})
-      ret = insert(begin() + id, item);
-    return ret;
+    size_type index = check_position(pos);
+    if (index == size()) {
+      emplace_back(std::forward<Args>(args)...);
+      return begin() + index;
+    }
+    T value(std::forward<Args>(args)...);
+    return insert(pos, std::move(value));
   }
 
   template <class... Args>
   reference emplace_back(Args&&... args) {
-    return *emplace(iterator(vb.space), std::forward<Args>(args)...);
+    if (vb.space == vb.last) return realloc_append(std::forward<Args>(args)...);
+    ::new ((void*)vb.space) T(std::forward<Args>(args)...);
+    return *vb.space++;
   }
 
   iterator erase(iterator pos) {
@@ -299,19 +643,9 @@ class vector {
     return iterator(first);
   }
 
-  void push_back(const T& value) {
-    if (capacity() == size()) reserve(size() ? size() * 2 : 1);
-    /* vb.alloc.construct(&vb.elem[size()], value); */
-    ::new ((void*)&vb.elem[size()]) T(value);
-    ++vb.space;
-  }
+  void push_back(const T& value) { emplace_back(value); }
 
-  void push_back(T&& value) {
-    if (capacity() == size()) reserve(size() ? size() * 2 : 1);
-    /* vb.alloc.construct(&vb.elem[size()], std::move(value)); */
-    ::new ((void*)&vb.elem[size()]) T(std::move(value));
-    ++vb.space;
-  }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
 
   void pop_back() {
     if (size() && vb.space) {
@@ -325,7 +659,7 @@ class vector {
 
   void resize(size_type newsize, const_reference value) {
     if (newsize < max_size()) {
-      if (newsize != 0) reserve(std::max(newsize, capacity() * 2));
+      if (newsize > capacity()) reserve(recommend(newsize));
 
       if (size() < newsize) {
         std::uninitialized_fill(vb.elem + size(), vb.elem + newsize, value);
@@ -338,8 +672,75 @@ class vector {
     }
   }
 
+  /* Like resize, but new elements are left uninitialized (default-init)
+   * instead of being written with T(), for buffers that are filled right
+   * away */
+  void resize_uninitialized(size_type newsize) {
+    static_assert(std::is_trivially_default_constructible_v<T> &&
+                      std::is_trivially_destructible_v<T>,
+                  "resize_uninitialized needs a trivial T");
+    if (newsize > capacity()) reserve(recommend(newsize));
+    vb.space = vb.elem + newsize;
+  }
+
+  /* Grows the vector by n uninitialized elements and returns a pointer to
+   * the first of them */
+  pointer append_uninitialized(size_type n) {
+    const size_type sz = size();
+    if (n > max_size() - sz) throw std::length_error("vector too long");
+    resize_uninitialized(sz + n);
+    return vb.elem + sz;
+  }
+
   void swap(vector& other) noexcept { std::swap(vb, other.vb); }
 
+ private:
+  typedef vector_ops<T, A> ops;
+  friend ops;
+
+  size_type check_position(iterator pos) {
+    if (pos < begin() || pos > end())
+      throw std::out_of_range("position is out of range");
+    return pos - begin();
+  }
+
+  /* New capacity for at least needed elements */
+  size_type recommend(size_type needed) const {
+    if (needed > max_size()) throw std::length_error("vector too long");
+    return std::min<size_type>(
+        std::max<size_type>(Growth::next(capacity(), needed, sizeof(T)), 1),
+        max_size());
+  }
+
+  /* Storage hooks of vector_ops */
+  pointer allocate(size_type n) { return vb.allocate(n); }
+  void deallocate(pointer p, size_type n) noexcept {
+    vector_base<T, A>::deallocate(vb.alloc, p, n);
+  }
+  void adopt(pointer b, pointer space, size_type n) noexcept {
+    deallocate(vb.elem, capacity());
+    vb.elem = b;
+    vb.space = space;
+    vb.last = b + n;
+  }
+  bool reallocatable() const noexcept { return true; }
+  void reallocate(size_type n) { vb.reallocate(n); }
+  void set_size(size_type n) noexcept { vb.space = vb.elem + n; }
+  A& alloc_ref() noexcept { return vb.alloc; }
+
+  template <class... Args>
+  reference realloc_append(Args&&... args) {
+    return ops::realloc_append(*this, std::forward<Args>(args)...);
+  }
+
+  template <class Fill>
+  iterator insert_gap(size_type index, size_type count, Fill fill) {
+    ops::insert_gap(*this, index, count, fill);
+    return begin() + index;
+  }
+
+ public:
+
   class iterator {
    public:
     typedef typename A::difference_type difference_type;
@@ -677,10 +1078,10 @@ class vector {
   };
 };
 
-template <class T, class A>
-bool operator==(const vector<T, A>& a, const vector<T, A>& b) {
+template <class T, class A, class G>
+bool operator==(const vector<T, A, G>& a, const vector<T, A, G>& b) {
   if (a.size() != b.size()) return false;
-  for (typename vector<T, A>::const_iterator i = a.begin(), j = b.begin();
+  for (typename vector<T, A, G>::const_iterator i = a.begin(), j = b.begin();
        i != a.end(); ++i, ++j)
     if (!(*i == *j)) return false;
   return true;
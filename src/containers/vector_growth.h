@@ -0,0 +1,65 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_VECTOR_GROWTH_H_
+#define _STL_CONTAINERS_CONTAINERS_VECTOR_GROWTH_H_
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+
+/* Growth policies of s21::vector. next(capacity, needed, elem_size) returns
+ * the new capacity, at least needed, for a vector of the given capacity that
+ * has to hold needed elements of elem_size bytes. Growth is only asked for
+ * when needed > capacity.
+ */
+
+/* Doubles the capacity, the default */
+struct growth_double {
+  static std::size_t next(std::size_t capacity, std::size_t needed,
+                          std::size_t) {
+    return std::max(needed, capacity * 2);
+  }
+};
+
+/* Grows by half: more reallocations than doubling, but freed blocks can be
+ * reused by later growth and less memory sits unused */
+struct growth_golden {
+  static std::size_t next(std::size_t capacity, std::size_t needed,
+                          std::size_t) {
+    return std::max(needed, capacity + capacity / 2);
+  }
+};
+
+/* Allocates exactly what is needed, for vectors that are sized up front */
+struct growth_exact {
+  static std::size_t next(std::size_t, std::size_t needed, std::size_t) {
+    return needed;
+  }
+};
+
+/* Grows by half and rounds the block up to the malloc size class it would
+ * land in anyway (16-byte steps for small blocks, then four classes per
+ * power of two, as in jemalloc and tcmalloc), so the slack becomes usable
+ * capacity instead of being wasted inside the allocation */
+struct growth_size_class {
+  static std::size_t next(std::size_t capacity, std::size_t needed,
+                          std::size_t elem_size) {
+    std::size_t n = std::max(needed, capacity + capacity / 2);
+    if (n > max_bytes / elem_size) return n;
+    return std::max(n, size_class(n * elem_size) / elem_size);
+  }
+
+  static std::size_t size_class(std::size_t bytes) {
+    if (bytes <= 128) return (bytes + 15) & ~std::size_t(15);
+    std::size_t pow = 128;
+    while (pow * 2 < bytes) pow *= 2;
+    std::size_t step = pow / 4;
+    return (bytes + step - 1) / step * step;
+  }
+
+ private:
+  static constexpr std::size_t max_bytes = std::size_t(1) << 48;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_VECTOR_GROWTH_H_
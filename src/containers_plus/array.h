@@ -7,7 +7,7 @@
 namespace s21 {
 template <class T, std::size_t N>
 struct array {
-  T a[N]{0};
+  T a[N]{};
 
  public:
   typedef T value_type;
@@ -0,0 +1,398 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_BITVECTOR_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_BITVECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../containers/vector.h"
+#include "simd.h"
+
+namespace s21 {
+
+/* Dynamic array of bits packed 64 to a word, for bitmaps where
+ * s21::vector<bool> and its byte per flag is 8 times too big. Elements are
+ * reached through proxy references. count, find_first/find_next and the
+ * bitwise operators work a word at a time, through the simd word kernels
+ * (vector AND/OR/XOR/NOT, hardware popcount).
+ *
+ * Bits past size() in the last word are always zero.
+ */
+class bitvector {
+ public:
+  typedef std::uint64_t word_type;
+  typedef bool value_type;
+  typedef bool const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  static constexpr size_type bits_per_word = 64;
+  static constexpr size_type npos = size_type(-1);
+
+  class reference {
+   public:
+    operator bool() const noexcept { return (*word & mask) != 0; }
+    bool operator~() const noexcept { return !bool(*this); }
+
+    reference& operator=(bool value) noexcept {
+      if (value)
+        *word |= mask;
+      else
+        *word &= ~mask;
+      return *this;
+    }
+
+    reference& operator=(const reference& other) noexcept {
+      return *this = bool(other);
+    }
+
+    void flip() noexcept { *word ^= mask; }
+
+   private:
+    friend class bitvector;
+    reference(word_type* w, word_type m) noexcept : word{w}, mask{m} {}
+
+    word_type* word;
+    word_type mask;
+  };
+
+  template <bool Const>
+  class basic_iterator;
+  typedef basic_iterator<false> iterator;
+  typedef basic_iterator<true> const_iterator;
+
+  bitvector() : words(), bits{0} {}
+
+  explicit bitvector(size_type count, bool value = false)
+      : words(word_count(count), value ? ~word_type(0) : 0), bits{count} {
+    clear_tail();
+  }
+
+  bitvector(std::initializer_list<bool> init) : bitvector() {
+    reserve(init.size());
+    for (bool b : init) push_back(b);
+  }
+
+  reference operator[](size_type pos) noexcept {
+    return reference(&words[pos / bits_per_word], bit(pos));
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return (words[pos / bits_per_word] & bit(pos)) != 0;
+  }
+
+  reference at(size_type pos) {
+    check(pos);
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    check(pos);
+    return (*this)[pos];
+  }
+
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[bits - 1]; }
+  const_reference back() const noexcept { return (*this)[bits - 1]; }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return iterator(this, bits); }
+  const_iterator end() const noexcept { return const_iterator(this, bits); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return bits == 0; }
+  size_type size() const noexcept { return bits; }
+  size_type max_size() const noexcept {
+    size_type w = words.max_size();
+    return w > npos / bits_per_word ? npos - 1 : w * bits_per_word;
+  }
+  size_type capacity() const noexcept {
+    return words.capacity() * bits_per_word;
+  }
+
+  void reserve(size_type n) { words.reserve(word_count(n)); }
+  void shrink_to_fit() { words.shrink_to_fit(); }
+
+  /* The packed words, least significant bit first */
+  word_type* data() noexcept { return words.data(); }
+  const word_type* data() const noexcept { return words.data(); }
+  size_type word_size() const noexcept { return words.size(); }
+
+  void clear() noexcept {
+    words.clear();
+    bits = 0;
+  }
+
+  void push_back(bool value) {
+    if (bits % bits_per_word == 0) words.push_back(0);
+    ++bits;
+    back() = value;
+  }
+
+  void pop_back() noexcept {
+    --bits;
+    if (bits % bits_per_word == 0)
+      words.pop_back();
+    else
+      clear_tail();
+  }
+
+  void resize(size_type count, bool value = false) {
+    if (count > bits && value) {
+      // fill the rest of the current last word, then whole words
+      if (bits % bits_per_word != 0)
+        words.back() |= ~word_type(0) << (bits % bits_per_word);
+      words.resize(word_count(count), ~word_type(0));
+    } else {
+      words.resize(word_count(count), 0);
+    }
+    bits = count;
+    clear_tail();
+  }
+
+  void swap(bitvector& other) noexcept {
+    words.swap(other.words);
+    std::swap(bits, other.bits);
+  }
+
+  bitvector& set(size_type pos, bool value = true) {
+    at(pos) = value;
+    return *this;
+  }
+
+  bitvector& reset(size_type pos) { return set(pos, false); }
+
+  bitvector& flip(size_type pos) {
+    at(pos).flip();
+    return *this;
+  }
+
+  bool test(size_type pos) const { return at(pos); }
+
+  /* Sets every bit */
+  bitvector& set() noexcept {
+    std::fill(words.begin(), words.end(), ~word_type(0));
+    clear_tail();
+    return *this;
+  }
+
+  /* Clears every bit */
+  bitvector& reset() noexcept {
+    std::fill(words.begin(), words.end(), word_type(0));
+    return *this;
+  }
+
+  /* Flips every bit */
+  bitvector& flip() noexcept {
+    simd::not_n(words.data(), words.data(), words.size());
+    clear_tail();
+    return *this;
+  }
+
+  /* Number of set bits */
+  size_type count() const noexcept {
+    return simd::popcount_n(words.data(), words.size());
+  }
+
+  bool any() const noexcept { return find_first() != npos; }
+  bool none() const noexcept { return !any(); }
+  bool all() const noexcept { return count() == bits; }
+
+  /* Index of the first set bit, or npos */
+  size_type find_first() const noexcept { return scan(0); }
+
+  /* Index of the first set bit after pos, or npos */
+  size_type find_next(size_type pos) const noexcept {
+    if (pos >= bits || ++pos == bits) return npos;
+    size_type w = pos / bits_per_word;
+    word_type rest = words[w] & (~word_type(0) << (pos % bits_per_word));
+    if (rest != 0) return w * bits_per_word + __builtin_ctzll(rest);
+    return scan(w + 1);
+  }
+
+  /* The bitwise assignments need operands of the same size and throw
+   * std::invalid_argument otherwise */
+
+  bitvector& operator&=(const bitvector& other) {
+    check_same_size(other);
+    simd::and_n(words.data(), words.data(), other.words.data(), words.size());
+    return *this;
+  }
+
+  bitvector& operator|=(const bitvector& other) {
+    check_same_size(other);
+    simd::or_n(words.data(), words.data(), other.words.data(), words.size());
+    return *this;
+  }
+
+  bitvector& operator^=(const bitvector& other) {
+    check_same_size(other);
+    simd::xor_n(words.data(), words.data(), other.words.data(), words.size());
+    return *this;
+  }
+
+  bitvector operator~() const {
+    bitvector res(*this);
+    res.flip();
+    return res;
+  }
+
+  friend bool operator==(const bitvector& a, const bitvector& b) {
+    return a.bits == b.bits &&
+           std::equal(a.words.begin(), a.words.end(), b.words.begin());
+  }
+
+  friend bool operator!=(const bitvector& a, const bitvector& b) {
+    return !(a == b);
+  }
+
+  template <bool Const>
+  class basic_iterator {
+    typedef std::conditional_t<Const, const bitvector, bitvector> owner_type;
+
+   public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef bool value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef std::conditional_t<Const, bool, bitvector::reference> reference;
+
+    basic_iterator() noexcept : owner{nullptr}, idx{0} {}
+
+    template <bool C = Const, class = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false>& other) noexcept
+        : owner{other.owner}, idx{other.idx} {}
+
+    reference operator*() const noexcept { return (*owner)[idx]; }
+    reference operator[](difference_type n) const noexcept {
+      return (*owner)[idx + n];
+    }
+
+    basic_iterator& operator++() noexcept {
+      ++idx;
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {
+      basic_iterator tmp = *this;
+      ++idx;
+      return tmp;
+    }
+    basic_iterator& operator--() noexcept {
+      --idx;
+      return *this;
+    }
+    basic_iterator operator--(int) noexcept {
+      basic_iterator tmp = *this;
+      --idx;
+      return tmp;
+    }
+    basic_iterator& operator+=(difference_type n) noexcept {
+      idx += n;
+      return *this;
+    }
+    basic_iterator& operator-=(difference_type n) noexcept {
+      idx -= n;
+      return *this;
+    }
+    basic_iterator operator+(difference_type n) const noexcept {
+      return basic_iterator(owner, idx + n);
+    }
+    basic_iterator operator-(difference_type n) const noexcept {
+      return basic_iterator(owner, idx - n);
+    }
+    difference_type operator-(const basic_iterator& other) const noexcept {
+      return difference_type(idx) - difference_type(other.idx);
+    }
+
+    bool operator==(const basic_iterator& other) const noexcept {
+      return idx == other.idx;
+    }
+    bool operator!=(const basic_iterator& other) const noexcept {
+      return idx != other.idx;
+    }
+    bool operator<(const basic_iterator& other) const noexcept {
+      return idx < other.idx;
+    }
+    bool operator>(const basic_iterator& other) const noexcept {
+      return idx > other.idx;
+    }
+    bool operator<=(const basic_iterator& other) const noexcept {
+      return idx <= other.idx;
+    }
+    bool operator>=(const basic_iterator& other) const noexcept {
+      return idx >= other.idx;
+    }
+
+   private:
+    friend class bitvector;
+    friend class basic_iterator<true>;
+
+    basic_iterator(owner_type* o, size_type i) noexcept : owner{o}, idx{i} {}
+
+    owner_type* owner;
+    size_type idx;
+  };
+
+ private:
+  static size_type word_count(size_type n) noexcept {
+    return (n + bits_per_word - 1) / bits_per_word;
+  }
+
+  static word_type bit(size_type pos) noexcept {
+    return word_type(1) << (pos % bits_per_word);
+  }
+
+  void check(size_type pos) const {
+    if (pos >= bits) throw std::out_of_range("bitvector::at");
+  }
+
+  void check_same_size(const bitvector& other) const {
+    if (bits != other.bits)
+      throw std::invalid_argument("bitvector: operands differ in size");
+  }
+
+  /* Zeroes the bits of the last word past size() */
+  void clear_tail() noexcept {
+    if (bits % bits_per_word != 0)
+      words.back() &= ~(~word_type(0) << (bits % bits_per_word));
+  }
+
+  /* First set bit in the words from w on */
+  size_type scan(size_type w) const noexcept {
+    for (; w < words.size(); ++w)
+      if (words[w] != 0) return w * bits_per_word + __builtin_ctzll(words[w]);
+    return npos;
+  }
+
+  vector<word_type> words;
+  size_type bits;
+};
+
+inline bitvector operator&(bitvector a, const bitvector& b) {
+  a &= b;
+  return a;
+}
+
+inline bitvector operator|(bitvector a, const bitvector& b) {
+  a |= b;
+  return a;
+}
+
+inline bitvector operator^(bitvector a, const bitvector& b) {
+  a ^= b;
+  return a;
+}
+
+inline void swap(bitvector& a, bitvector& b) noexcept { a.swap(b); }
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_BITVECTOR_H_
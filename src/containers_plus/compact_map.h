@@ -0,0 +1,99 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_MAP_H_
+
+#include <initializer_list>
+
+#include "compact_tree.h"
+
+namespace s21 {
+
+/* s21::map over compact_tree: same interface, 32-bit links in one arena.
+ * Iterators dereference to the key like s21::map; the value is value().
+ */
+template <class Key, class T, class Compare = std::less<Key>>
+class compact_map {
+ public:
+  typedef compact_tree<Key, T, Compare> tree_type;
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+  typedef typename tree_type::iterator iterator;
+  typedef typename tree_type::const_iterator const_iterator;
+
+  compact_map() : tree{} {}
+
+  compact_map(std::initializer_list<value_type> init) : tree{} {
+    tree.reserve(init.size());
+    for (const value_type& v : init) tree.insert(v.first, v.second);
+  }
+
+  T& at(const Key& key) {
+    iterator it = tree.find(key);
+    if (it == tree.end()) throw std::out_of_range("compact_map::at");
+    return it.value();
+  }
+
+  const T& at(const Key& key) const {
+    const_iterator it = tree.find(key);
+    if (it == tree.end()) throw std::out_of_range("compact_map::at");
+    return it.value();
+  }
+
+  T& operator[](const Key& key) { return tree.insert(key, T()).first.value(); }
+
+  iterator begin() noexcept { return tree.begin(); }
+  const_iterator begin() const noexcept { return tree.begin(); }
+  const_iterator cbegin() const noexcept { return tree.begin(); }
+  iterator end() noexcept { return tree.end(); }
+  const_iterator end() const noexcept { return tree.end(); }
+  const_iterator cend() const noexcept { return tree.end(); }
+
+  bool empty() const noexcept { return tree.empty(); }
+  size_type size() const noexcept { return tree.size(); }
+
+  void clear() noexcept { tree.clear(); }
+
+  void reserve(size_type n) { tree.reserve(n); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree.insert(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    return tree.insert_or_assign(key, obj);
+  }
+
+  size_type erase(const Key& key) { return tree.erase(key); }
+
+  iterator erase(const_iterator pos) { return tree.erase(pos); }
+
+  void swap(compact_map& other) noexcept { tree.swap(other.tree); }
+
+  iterator find(const Key& key) { return tree.find(key); }
+  const_iterator find(const Key& key) const { return tree.find(key); }
+
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  iterator lower_bound(const Key& key) { return tree.lower_bound(key); }
+  const_iterator lower_bound(const Key& key) const {
+    return tree.lower_bound(key);
+  }
+  iterator upper_bound(const Key& key) { return tree.upper_bound(key); }
+  const_iterator upper_bound(const Key& key) const {
+    return tree.upper_bound(key);
+  }
+
+  void write(std::ostream& out) const { tree.write(out); }
+  void read(std::istream& in) { tree.read(in); }
+
+  const tree_type& get_tree() const noexcept { return tree; }
+
+ private:
+  tree_type tree;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_MAP_H_
@@ -0,0 +1,74 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_SET_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_SET_H_
+
+#include <initializer_list>
+
+#include "compact_tree.h"
+
+namespace s21 {
+
+/* s21::set over compact_tree, see compact_map.h */
+template <class Key, class Compare = std::less<Key>>
+class compact_set {
+ public:
+  typedef char T;
+  typedef compact_tree<Key, T, Compare> tree_type;
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+  typedef typename tree_type::const_iterator iterator;
+  typedef typename tree_type::const_iterator const_iterator;
+
+  compact_set() : tree{} {}
+
+  compact_set(std::initializer_list<value_type> init) : tree{} {
+    tree.reserve(init.size());
+    for (const value_type& v : init) tree.insert(v, T());
+  }
+
+  const_iterator begin() const noexcept { return tree.begin(); }
+  const_iterator cbegin() const noexcept { return tree.begin(); }
+  const_iterator end() const noexcept { return tree.end(); }
+  const_iterator cend() const noexcept { return tree.end(); }
+
+  bool empty() const noexcept { return tree.empty(); }
+  size_type size() const noexcept { return tree.size(); }
+
+  void clear() noexcept { tree.clear(); }
+
+  void reserve(size_type n) { tree.reserve(n); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree.insert(value, T());
+  }
+
+  size_type erase(const Key& key) { return tree.erase(key); }
+
+  iterator erase(const_iterator pos) { return tree.erase(pos); }
+
+  void swap(compact_set& other) noexcept { tree.swap(other.tree); }
+
+  const_iterator find(const Key& key) const { return tree.find(key); }
+
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  const_iterator lower_bound(const Key& key) const {
+    return tree.lower_bound(key);
+  }
+  const_iterator upper_bound(const Key& key) const {
+    return tree.upper_bound(key);
+  }
+
+  void write(std::ostream& out) const { tree.write(out); }
+  void read(std::istream& in) { tree.read(in); }
+
+  const tree_type& get_tree() const noexcept { return tree; }
+
+ private:
+  tree_type tree;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_SET_H_
@@ -0,0 +1,575 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_TREE_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_TREE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* Red-black tree whose nodes live in one s21::vector and link to each other
+ * with 32-bit indices instead of pointers. Erased nodes go to a free list
+ * (threaded through left) and are reused by later inserts.
+ *
+ * Nothing in the arena depends on its address: copying the tree copies one
+ * vector, and with trivially copyable keys and values write()/read() store
+ * and load the arena as raw bytes.
+ *
+ * Inserts may grow the arena, which invalidates references to elements but
+ * not iterators (they hold an index).
+ */
+template <class K, class V, class Compare = std::less<K>>
+class compact_tree {
+ public:
+  typedef std::uint32_t index_type;
+  typedef std::size_t size_type;
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef Compare key_compare;
+
+  static constexpr index_type kNil = 0xffffffffu;
+
+  struct node {
+    K key;
+    V value;
+    index_type left;
+    index_type right;
+    index_type parent;
+    bool red;
+  };
+
+  template <bool Const>
+  class basic_iterator;
+  typedef basic_iterator<false> iterator;
+  typedef basic_iterator<true> const_iterator;
+
+  compact_tree()
+      : nodes{}, root{kNil}, free_head{kNil}, sz{0}, comp{} {}
+
+  iterator begin() noexcept { return iterator(this, first()); }
+  const_iterator begin() const noexcept {
+    return const_iterator(this, first());
+  }
+  iterator end() noexcept { return iterator(this, kNil); }
+  const_iterator end() const noexcept { return const_iterator(this, kNil); }
+
+  bool empty() const noexcept { return sz == 0; }
+  size_type size() const noexcept { return sz; }
+
+  /* Nodes in the arena, live and free */
+  size_type arena_size() const noexcept { return nodes.size(); }
+
+  void reserve(size_type n) { nodes.reserve(n); }
+
+  void clear() noexcept {
+    vector<node> tmp;
+    nodes.swap(tmp);
+    root = free_head = kNil;
+    sz = 0;
+  }
+
+  std::pair<iterator, bool> insert(const K& key, const V& value) {
+    std::pair<index_type, bool> res = insert_node(key, value);
+    return std::make_pair(iterator(this, res.first), res.second);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const K& key, const V& value) {
+    std::pair<index_type, bool> res = insert_node(key, value);
+    if (!res.second) nodes[res.first].value = value;
+    return std::make_pair(iterator(this, res.first), res.second);
+  }
+
+  size_type erase(const K& key) {
+    index_type z = find_index(key);
+    if (z == kNil) return 0;
+    erase_node(z);
+    return 1;
+  }
+
+  iterator erase(const_iterator pos) {
+    index_type next = successor(pos.index());
+    erase_node(pos.index());
+    return iterator(this, next);
+  }
+
+  void swap(compact_tree& other) noexcept {
+    nodes.swap(other.nodes);
+    std::swap(root, other.root);
+    std::swap(free_head, other.free_head);
+    std::swap(sz, other.sz);
+    std::swap(comp, other.comp);
+  }
+
+  iterator find(const K& key) { return iterator(this, find_index(key)); }
+  const_iterator find(const K& key) const {
+    return const_iterator(this, find_index(key));
+  }
+
+  iterator lower_bound(const K& key) {
+    return iterator(this, bound(key, false));
+  }
+  const_iterator lower_bound(const K& key) const {
+    return const_iterator(this, bound(key, false));
+  }
+  iterator upper_bound(const K& key) {
+    return iterator(this, bound(key, true));
+  }
+  const_iterator upper_bound(const K& key) const {
+    return const_iterator(this, bound(key, true));
+  }
+
+  /* The arena slot i, read-only: writing keys or links would break the
+   * tree */
+  const node& operator[](index_type i) const { return nodes[i]; }
+
+  /* Black height of the tree, or -1 if a red-black invariant is broken */
+  int verify() const {
+    if (root != kNil && nodes[root].red) return -1;
+    return verify(root, kNil, kNil, kNil);
+  }
+
+  /* Stores the arena as raw bytes */
+  void write(std::ostream& out) const {
+    static_assert(std::is_trivially_copyable<node>::value,
+                  "compact_tree::write needs trivially copyable K and V");
+    file_header h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.node_size = sizeof(node);
+    h.root = root;
+    h.free_head = free_head;
+    h.size = sz;
+    h.count = nodes.size();
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    if (!nodes.empty())
+      out.write(reinterpret_cast<const char*>(nodes.data()),
+                nodes.size() * sizeof(node));
+    if (!out) throw std::runtime_error("compact_tree::write");
+  }
+
+  /* Loads an arena stored by write(); no pointers need fixing up. A
+   * corrupt file is rejected before it replaces the tree: every link has
+   * to stay inside the arena, the nodes reachable from root have to form
+   * a red-black tree of h.size nodes, and the free list has to hold every
+   * other slot exactly once. */
+  void read(std::istream& in) {
+    static_assert(std::is_trivially_copyable<node>::value,
+                  "compact_tree::read needs trivially copyable K and V");
+    file_header h{};
+    in.read(reinterpret_cast<char*>(&h), sizeof(h));
+    if (!in || !valid_header(h))
+      throw std::runtime_error("compact_tree::read: bad header");
+
+    vector<node> tmp(h.count);
+    if (h.count != 0)
+      in.read(reinterpret_cast<char*>(tmp.data()), h.count * sizeof(node));
+    if (!in) throw std::runtime_error("compact_tree::read: truncated");
+    for (const node& n : tmp)
+      if (!valid_link(n.left, h.count) || !valid_link(n.right, h.count) ||
+          !valid_link(n.parent, h.count))
+        throw std::runtime_error("compact_tree::read: bad link");
+
+    compact_tree t;
+    t.nodes.swap(tmp);
+    t.root = h.root;
+    t.free_head = h.free_head;
+    t.sz = h.size;
+    t.comp = comp;
+    if (!t.valid_arena() || t.verify() < 0)
+      throw std::runtime_error("compact_tree::read: bad tree");
+    swap(t);
+  }
+
+  template <bool Const>
+  class basic_iterator {
+    typedef typename std::conditional<Const, const compact_tree*,
+                                      compact_tree*>::type tree_ptr;
+
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef K value_type;
+    typedef const K& reference;
+    typedef const K* pointer;
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef typename std::conditional<Const, const V&, V&>::type
+        mapped_reference;
+
+    basic_iterator() : t{nullptr}, i{kNil} {}
+    basic_iterator(tree_ptr tree, index_type index) : t{tree}, i{index} {}
+
+    // iterator -> const_iterator
+    template <bool C = Const, class = typename std::enable_if<C>::type>
+    basic_iterator(const basic_iterator<false>& other)
+        : t{other.tree()}, i{other.index()} {}
+
+    bool operator==(const basic_iterator& other) const { return i == other.i; }
+    bool operator!=(const basic_iterator& other) const { return i != other.i; }
+
+    basic_iterator& operator++() {
+      i = t->successor(i);
+      return *this;
+    }
+
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      i = t->successor(i);
+      return tmp;
+    }
+
+    basic_iterator& operator--() {
+      i = i == kNil ? t->last() : t->predecessor(i);
+      return *this;
+    }
+
+    basic_iterator operator--(int) {
+      basic_iterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    const K& operator*() const { return t->nodes[i].key; }
+
+    const K& key() const { return t->nodes[i].key; }
+    mapped_reference value() const { return t->nodes[i].value; }
+
+    tree_ptr tree() const { return t; }
+    index_type index() const { return i; }
+
+   private:
+    tree_ptr t;
+    index_type i;
+  };
+
+ private:
+  struct file_header {
+    char magic[8];
+    std::uint64_t node_size;
+    std::uint64_t size;
+    std::uint64_t count;
+    std::uint32_t root;
+    std::uint32_t free_head;
+  };
+
+  static constexpr char kMagic[8] = {'S', '2', '1', 'C', 'T', 'R', 'E', 'E'};
+
+  // indices stay below kNil, so count * sizeof(node) cannot overflow
+  static bool valid_header(const file_header& h) {
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 ||
+        h.node_size != sizeof(node) || h.count >= kNil || h.size > h.count)
+      return false;
+    if ((h.root == kNil) != (h.size == 0)) return false;
+    if (h.root != kNil && h.root >= h.count) return false;
+    return h.free_head == kNil || h.free_head < h.count;
+  }
+
+  static bool valid_link(index_type i, std::uint64_t count) {
+    return i == kNil || i < count;
+  }
+
+  // a red-black tree of n nodes is at most 2 * log2(n + 1) high
+  static constexpr int kMaxHeight = 64;
+
+  /* Whether root reaches exactly sz nodes, each through the parent it
+   * names and no deeper than kMaxHeight (so verify() cannot recurse
+   * without bound), and the free list reaches every other slot once. The
+   * links are known to stay inside the arena. */
+  bool valid_arena() const {
+    vector<unsigned char> seen(nodes.size(), 0);
+    size_type live = 0;
+    if (root != kNil) {
+      if (nodes[root].parent != kNil) return false;
+      vector<std::pair<index_type, int>> stack;
+      stack.push_back(std::make_pair(root, 1));
+      seen[root] = 1;
+      while (!stack.empty()) {
+        std::pair<index_type, int> top = stack.back();
+        stack.pop_back();
+        if (++live > sz || top.second > kMaxHeight) return false;
+        const node& n = nodes[top.first];
+        for (index_type c : {n.left, n.right}) {
+          if (c == kNil) continue;
+          if (seen[c] || nodes[c].parent != top.first) return false;
+          seen[c] = 1;
+          stack.push_back(std::make_pair(c, top.second + 1));
+        }
+      }
+    }
+    if (live != sz) return false;
+
+    size_type free = 0;
+    for (index_type i = free_head; i != kNil; i = nodes[i].left) {
+      if (seen[i]) return false;
+      seen[i] = 1;
+      ++free;
+    }
+    return free == nodes.size() - sz;
+  }
+
+  bool is_red(index_type i) const { return i != kNil && nodes[i].red; }
+
+  index_type minimum(index_type i) const {
+    while (nodes[i].left != kNil) i = nodes[i].left;
+    return i;
+  }
+
+  index_type maximum(index_type i) const {
+    while (nodes[i].right != kNil) i = nodes[i].right;
+    return i;
+  }
+
+  index_type first() const { return root == kNil ? kNil : minimum(root); }
+  index_type last() const { return root == kNil ? kNil : maximum(root); }
+
+  index_type successor(index_type i) const {
+    if (nodes[i].right != kNil) return minimum(nodes[i].right);
+    index_type p = nodes[i].parent;
+    while (p != kNil && i == nodes[p].right) {
+      i = p;
+      p = nodes[p].parent;
+    }
+    return p;
+  }
+
+  index_type predecessor(index_type i) const {
+    if (nodes[i].left != kNil) return maximum(nodes[i].left);
+    index_type p = nodes[i].parent;
+    while (p != kNil && i == nodes[p].left) {
+      i = p;
+      p = nodes[p].parent;
+    }
+    return p;
+  }
+
+  index_type find_index(const K& key) const {
+    index_type x = root;
+    while (x != kNil) {
+      if (comp(key, nodes[x].key))
+        x = nodes[x].left;
+      else if (comp(nodes[x].key, key))
+        x = nodes[x].right;
+      else
+        return x;
+    }
+    return kNil;
+  }
+
+  // first key not less than key, or greater than key if upper
+  index_type bound(const K& key, bool upper) const {
+    index_type x = root, res = kNil;
+    while (x != kNil) {
+      bool go_left =
+          upper ? comp(key, nodes[x].key) : !comp(nodes[x].key, key);
+      if (go_left) {
+        res = x;
+        x = nodes[x].left;
+      } else {
+        x = nodes[x].right;
+      }
+    }
+    return res;
+  }
+
+  index_type allocate_node(const K& key, const V& value) {
+    if (free_head != kNil) {
+      index_type z = free_head;
+      free_head = nodes[z].left;
+      nodes[z].key = key;
+      nodes[z].value = value;
+      return z;
+    }
+    if (nodes.size() >= kNil) throw std::length_error("compact_tree is full");
+    nodes.push_back(node{key, value, kNil, kNil, kNil, true});
+    return static_cast<index_type>(nodes.size() - 1);
+  }
+
+  void free_node(index_type z) {
+    if (!std::is_trivially_destructible<K>::value) nodes[z].key = K();
+    if (!std::is_trivially_destructible<V>::value) nodes[z].value = V();
+    nodes[z].left = free_head;
+    nodes[z].right = nodes[z].parent = kNil;
+    free_head = z;
+  }
+
+  std::pair<index_type, bool> insert_node(const K& key, const V& value) {
+    index_type p = kNil, x = root;
+    bool left = false;
+    while (x != kNil) {
+      p = x;
+      if (comp(key, nodes[x].key)) {
+        x = nodes[x].left;
+        left = true;
+      } else if (comp(nodes[x].key, key)) {
+        x = nodes[x].right;
+        left = false;
+      } else {
+        return std::make_pair(x, false);
+      }
+    }
+
+    index_type z = allocate_node(key, value);
+    node& n = nodes[z];
+    n.left = n.right = kNil;
+    n.parent = p;
+    n.red = true;
+    if (p == kNil)
+      root = z;
+    else if (left)
+      nodes[p].left = z;
+    else
+      nodes[p].right = z;
+    ++sz;
+    fix_insertion(z);
+    return std::make_pair(z, true);
+  }
+
+  void rotate_left(index_type x) {
+    index_type y = nodes[x].right;
+    nodes[x].right = nodes[y].left;
+    if (nodes[y].left != kNil) nodes[nodes[y].left].parent = x;
+    replace_child(x, y);
+    nodes[y].left = x;
+    nodes[x].parent = y;
+  }
+
+  void rotate_right(index_type x) {
+    index_type y = nodes[x].left;
+    nodes[x].left = nodes[y].right;
+    if (nodes[y].right != kNil) nodes[nodes[y].right].parent = x;
+    replace_child(x, y);
+    nodes[y].right = x;
+    nodes[x].parent = y;
+  }
+
+  // puts v where u hangs under u's parent
+  void replace_child(index_type u, index_type v) {
+    index_type p = nodes[u].parent;
+    if (p == kNil)
+      root = v;
+    else if (nodes[p].left == u)
+      nodes[p].left = v;
+    else
+      nodes[p].right = v;
+    if (v != kNil) nodes[v].parent = p;
+  }
+
+  void fix_insertion(index_type z) {
+    while (is_red(nodes[z].parent)) {
+      index_type p = nodes[z].parent;
+      index_type g = nodes[p].parent;
+      bool left = p == nodes[g].left;
+      index_type u = left ? nodes[g].right : nodes[g].left;
+      if (is_red(u)) {
+        nodes[p].red = nodes[u].red = false;
+        nodes[g].red = true;
+        z = g;
+        continue;
+      }
+      if (z == (left ? nodes[p].right : nodes[p].left)) {
+        z = p;
+        left ? rotate_left(z) : rotate_right(z);
+        p = nodes[z].parent;
+      }
+      nodes[p].red = false;
+      nodes[g].red = true;
+      left ? rotate_right(g) : rotate_left(g);
+    }
+    nodes[root].red = false;
+  }
+
+  void erase_node(index_type z) {
+    index_type y = z, x, xp;
+    bool removed_red = nodes[z].red;
+
+    if (nodes[z].left == kNil || nodes[z].right == kNil) {
+      x = nodes[z].left == kNil ? nodes[z].right : nodes[z].left;
+      xp = nodes[z].parent;
+      replace_child(z, x);
+    } else {
+      y = minimum(nodes[z].right);
+      removed_red = nodes[y].red;
+      x = nodes[y].right;
+      if (nodes[y].parent == z) {
+        xp = y;
+      } else {
+        xp = nodes[y].parent;
+        replace_child(y, x);
+        nodes[y].right = nodes[z].right;
+        nodes[nodes[y].right].parent = y;
+      }
+      replace_child(z, y);
+      nodes[y].left = nodes[z].left;
+      nodes[nodes[y].left].parent = y;
+      nodes[y].red = nodes[z].red;
+    }
+
+    if (!removed_red) fix_erasure(x, xp);
+    free_node(z);
+    --sz;
+  }
+
+  // x (possibly kNil) under xp is short of one black node
+  void fix_erasure(index_type x, index_type xp) {
+    while (x != root && !is_red(x)) {
+      bool left = x == nodes[xp].left;
+      index_type w = left ? nodes[xp].right : nodes[xp].left;
+      if (is_red(w)) {
+        nodes[w].red = false;
+        nodes[xp].red = true;
+        left ? rotate_left(xp) : rotate_right(xp);
+        w = left ? nodes[xp].right : nodes[xp].left;
+      }
+      index_type nephew_in = left ? nodes[w].left : nodes[w].right;
+      index_type nephew_out = left ? nodes[w].right : nodes[w].left;
+      if (!is_red(nephew_in) && !is_red(nephew_out)) {
+        nodes[w].red = true;
+        x = xp;
+        xp = nodes[x].parent;
+        continue;
+      }
+      if (!is_red(nephew_out)) {
+        nodes[nephew_in].red = false;
+        nodes[w].red = true;
+        left ? rotate_right(w) : rotate_left(w);
+        w = left ? nodes[xp].right : nodes[xp].left;
+        nephew_out = left ? nodes[w].right : nodes[w].left;
+      }
+      nodes[w].red = nodes[xp].red;
+      nodes[xp].red = false;
+      nodes[nephew_out].red = false;
+      left ? rotate_left(xp) : rotate_right(xp);
+      x = root;
+    }
+    if (x != kNil) nodes[x].red = false;
+  }
+
+  /* lo and hi are the nodes whose keys bound the subtree of i from below
+   * and above, kNil for no bound */
+  int verify(index_type i, index_type parent, index_type lo,
+             index_type hi) const {
+    if (i == kNil) return 1;
+    const node& n = nodes[i];
+    if (n.parent != parent) return -1;
+    if (n.red && (is_red(n.left) || is_red(n.right))) return -1;
+    if (lo != kNil && !comp(nodes[lo].key, n.key)) return -1;
+    if (hi != kNil && !comp(n.key, nodes[hi].key)) return -1;
+    int lh = verify(n.left, i, lo, i), rh = verify(n.right, i, i, hi);
+    if (lh < 0 || lh != rh) return -1;
+    return lh + (n.red ? 0 : 1);
+  }
+
+  vector<node> nodes;
+  index_type root;
+  index_type free_head;
+  size_type sz;
+  Compare comp;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_COMPACT_TREE_H_
@@ -0,0 +1,381 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_CONCURRENT_SKIPLIST_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_CONCURRENT_SKIPLIST_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "epoch_reclaim.h"
+
+namespace s21 {
+
+/* Lock-free ordered map on a skip list (Herlihy-Shavit with Fraser-style
+ * marked pointers). A node is removed by marking its next pointers from the
+ * top level down; the mark on level 0 is the linearization point. Searches
+ * unlink marked nodes they pass, and unlinked nodes are freed through
+ * epoch_domain.
+ *
+ * A node is owned by its inserter until all its levels are linked and by
+ * the thread that removed it; whichever finishes last runs a final search
+ * that unlinks the node everywhere and retires it.
+ *
+ * Values are copied out, and insert_or_assign swaps in a new value object.
+ * Iterators pin the epoch while they are alive: keep them short-lived and on
+ * the thread that created them. Iteration and scans see a consistent order
+ * but not a snapshot.
+ */
+template <class Key, class T, class Compare = std::less<Key>>
+class concurrent_skiplist_map {
+  static constexpr int kMaxLevel = 24;
+
+  typedef std::atomic<std::uintptr_t> link;
+
+  struct node {
+    node(const Key& k, T* v, int l) : key{k}, value{v}, level{l}, owners{2} {}
+
+    link* next() { return reinterpret_cast<link*>(this + 1); }
+
+    Key key;
+    std::atomic<T*> value;
+    int level;
+    std::atomic<int> owners;
+  };
+
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+
+  class iterator;
+  typedef iterator const_iterator;
+
+  concurrent_skiplist_map() : elements{0}, comp{} {
+    for (int l = 0; l < kMaxLevel; ++l) head[l].store(0);
+  }
+
+  concurrent_skiplist_map(std::initializer_list<value_type> init)
+      : concurrent_skiplist_map() {
+    for (const value_type& v : init) insert(v);
+  }
+
+  concurrent_skiplist_map(const concurrent_skiplist_map&) = delete;
+  concurrent_skiplist_map& operator=(const concurrent_skiplist_map&) = delete;
+
+  /* Must not run concurrently with other members */
+  ~concurrent_skiplist_map() {
+    node* n = ptr(head[0].load());
+    while (n != nullptr) {
+      node* next = ptr(n->next()[0].load());
+      destroy_node(n);
+      n = next;
+    }
+  }
+
+  T at(const Key& key) const {
+    epoch_domain::guard g;
+    node* n = lookup(key);
+    if (n == nullptr) throw std::out_of_range("concurrent_skiplist_map::at");
+    return *n->value.load();
+  }
+
+  iterator begin() const {
+    epoch_domain::guard g;
+    return iterator(skip_marked(ptr(head[0].load())));
+  }
+  iterator cbegin() const { return begin(); }
+  iterator end() const { return iterator(nullptr); }
+  iterator cend() const { return end(); }
+
+  /* Approximate while writers are running */
+  size_type size() const noexcept { return elements.load(); }
+  bool empty() const noexcept { return size() == 0; }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return insert_node(value.first, value.second, false);
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return insert_node(key, obj, false);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    return insert_node(key, obj, true);
+  }
+
+  size_type erase(const Key& key) {
+    epoch_domain::guard g;
+    link* preds[kMaxLevel];
+    node* succs[kMaxLevel];
+    if (!search(key, preds, succs)) return 0;
+
+    node* n = succs[0];
+    for (int l = n->level - 1; l > 0; --l) {
+      std::uintptr_t s = n->next()[l].load();
+      while (!marked(s) && !n->next()[l].compare_exchange_weak(s, s | 1)) {
+      }
+    }
+
+    std::uintptr_t s = n->next()[0].load();
+    while (!marked(s)) {
+      if (n->next()[0].compare_exchange_weak(s, s | 1)) {
+        --elements;
+        release(n);
+        return 1;
+      }
+    }
+    return 0;  // removed by another thread first
+  }
+
+  iterator find(const Key& key) const {
+    epoch_domain::guard g;
+    return iterator(lookup(key));
+  }
+
+  bool contains(const Key& key) const {
+    epoch_domain::guard g;
+    return lookup(key) != nullptr;
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  /* First key not less than key */
+  iterator lower_bound(const Key& key) const {
+    epoch_domain::guard g;
+    return iterator(lower_node(key));
+  }
+
+  /* First key greater than key */
+  iterator upper_bound(const Key& key) const {
+    epoch_domain::guard g;
+    node* n = lower_node(key);
+    if (n != nullptr && !comp(key, n->key)) n = skip_marked(next_of(n));
+    return iterator(n);
+  }
+
+  /* Calls f(key, value) for the keys in [lo, hi) in order */
+  template <class F>
+  void scan(const Key& lo, const Key& hi, F&& f) const {
+    epoch_domain::guard g;
+    for (node* n = lower_node(lo); n != nullptr && comp(n->key, hi);
+         n = skip_marked(next_of(n)))
+      f(static_cast<const Key&>(n->key),
+        static_cast<const T&>(*n->value.load()));
+  }
+
+  class iterator {
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef Key value_type;
+    typedef const Key& reference;
+    typedef const Key* pointer;
+    typedef std::forward_iterator_tag iterator_category;
+
+    iterator() : n{nullptr} {}
+    explicit iterator(node* p) : n{p} {}
+
+    bool operator==(const iterator& other) const { return n == other.n; }
+    bool operator!=(const iterator& other) const { return n != other.n; }
+
+    iterator& operator++() {
+      n = skip_marked(next_of(n));
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    const Key& operator*() const { return n->key; }
+
+    const Key& key() const { return n->key; }
+    T value() const { return *n->value.load(); }
+
+   private:
+    epoch_domain::guard g;
+    node* n;
+  };
+
+ private:
+  static node* ptr(std::uintptr_t v) {
+    return reinterpret_cast<node*>(v & ~static_cast<std::uintptr_t>(1));
+  }
+  static std::uintptr_t raw(node* n) {
+    return reinterpret_cast<std::uintptr_t>(n);
+  }
+  static bool marked(std::uintptr_t v) { return v & 1; }
+
+  static node* next_of(node* n) { return ptr(n->next()[0].load()); }
+
+  // first node from n on that is not being removed
+  static node* skip_marked(node* n) {
+    while (n != nullptr && marked(n->next()[0].load())) n = next_of(n);
+    return n;
+  }
+
+  static node* make_node(const Key& key, const T& obj, int level) {
+    void* mem = ::operator new(sizeof(node) + level * sizeof(link));
+    T* value = nullptr;
+    try {
+      value = new T(obj);
+      node* n = ::new (mem) node(key, value, level);
+      for (int l = 0; l < level; ++l) ::new (n->next() + l) link(0);
+      return n;
+    } catch (...) {
+      delete value;
+      ::operator delete(mem);
+      throw;
+    }
+  }
+
+  static void destroy_node(void* p) {
+    node* n = static_cast<node*>(p);
+    delete n->value.load();
+    for (int l = 0; l < n->level; ++l) n->next()[l].~link();
+    n->~node();
+    ::operator delete(p);
+  }
+
+  // geometric with p = 1/2
+  static int random_level() {
+    thread_local std::uint64_t state =
+        0x9e3779b97f4a7c15ull ^ reinterpret_cast<std::uintptr_t>(&state);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return 1 + __builtin_ctzll(state | (1ull << (kMaxLevel - 1)));
+  }
+
+  /* Fills preds/succs around key on every level, unlinking marked nodes on
+   * the way; returns whether succs[0] holds key */
+  bool search(const Key& key, link** preds, node** succs) const {
+    while (!try_search(key, preds, succs)) {
+    }
+    return succs[0] != nullptr && !comp(key, succs[0]->key);
+  }
+
+  bool try_search(const Key& key, link** preds, node** succs) const {
+    link* pred = head;
+    for (int l = kMaxLevel - 1; l >= 0; --l) {
+      node* curr = ptr(pred[l].load());
+      while (curr != nullptr) {
+        std::uintptr_t succ = curr->next()[l].load();
+        if (marked(succ)) {
+          std::uintptr_t expected = raw(curr);
+          if (!pred[l].compare_exchange_strong(expected, raw(ptr(succ))))
+            return false;
+          curr = ptr(succ);
+        } else if (comp(curr->key, key)) {
+          pred = curr->next();
+          curr = ptr(succ);
+        } else {
+          break;
+        }
+      }
+      preds[l] = pred;
+      succs[l] = curr;
+    }
+    return true;
+  }
+
+  // read-only descent that steps over marked nodes instead of unlinking them
+  node* lower_node(const Key& key) const {
+    const link* pred = head;
+    node* curr = nullptr;
+    for (int l = kMaxLevel - 1; l >= 0; --l) {
+      curr = ptr(pred[l].load());
+      while (curr != nullptr) {
+        std::uintptr_t succ = curr->next()[l].load();
+        if (marked(succ)) {
+          curr = ptr(succ);
+        } else if (comp(curr->key, key)) {
+          pred = curr->next();
+          curr = ptr(succ);
+        } else {
+          break;
+        }
+      }
+    }
+    return curr;
+  }
+
+  node* lookup(const Key& key) const {
+    node* n = lower_node(key);
+    return n != nullptr && !comp(key, n->key) ? n : nullptr;
+  }
+
+  std::pair<iterator, bool> insert_node(const Key& key, const T& obj,
+                                        bool assign) {
+    epoch_domain::guard g;
+    link* preds[kMaxLevel];
+    node* succs[kMaxLevel];
+    node* n = nullptr;
+
+    for (;;) {
+      if (search(key, preds, succs)) {
+        node* found = succs[0];
+        if (assign) {
+          T* old = found->value.exchange(new T(obj));
+          epoch_domain::instance().retire(old);
+        }
+        if (n != nullptr) destroy_node(n);
+        return std::make_pair(iterator(found), false);
+      }
+
+      if (n == nullptr) n = make_node(key, obj, random_level());
+      for (int l = 0; l < n->level; ++l) n->next()[l].store(raw(succs[l]));
+
+      std::uintptr_t expected = raw(succs[0]);
+      if (preds[0][0].compare_exchange_strong(expected, raw(n))) break;
+    }
+    ++elements;
+
+    iterator res(n);
+    link_upper(n, preds, succs);
+    release(n);
+    return std::make_pair(res, true);
+  }
+
+  // links levels 1.. of a node published on level 0; gives up once the node
+  // is being removed
+  void link_upper(node* n, link** preds, node** succs) {
+    for (int l = 1; l < n->level; ++l) {
+      for (;;) {
+        std::uintptr_t s = n->next()[l].load();
+        if (marked(s)) return;
+        if (ptr(s) != succs[l] &&
+            !n->next()[l].compare_exchange_strong(s, raw(succs[l])))
+          return;
+
+        std::uintptr_t expected = raw(succs[l]);
+        if (preds[l][l].compare_exchange_strong(expected, raw(n))) break;
+
+        search(n->key, preds, succs);
+        if (succs[0] != n) return;
+      }
+    }
+  }
+
+  void release(node* n) {
+    if (n->owners.fetch_sub(1) != 1) return;
+    link* preds[kMaxLevel];
+    node* succs[kMaxLevel];
+    search(n->key, preds, succs);
+    epoch_domain::instance().retire(n, destroy_node);
+  }
+
+  mutable link head[kMaxLevel];
+  std::atomic<size_type> elements;
+  Compare comp;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_CONCURRENT_SKIPLIST_MAP_H_
@@ -0,0 +1,162 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_CONCURRENT_UNORDERED_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_CONCURRENT_UNORDERED_MAP_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include "unordered_map.h"
+
+namespace s21 {
+
+/* Thread-safe hash map made of independent shards, each an unordered_map
+ * behind its own reader-writer lock. Readers of one shard run in parallel,
+ * writers block only their shard, and a shard grows on its own, so there is
+ * never a table-wide rehash. Shards are padded to a cache line.
+ *
+ * Values are returned by copy: a reference would outlive the shard lock.
+ */
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class concurrent_unordered_map {
+  struct alignas(64) shard {
+    mutable std::shared_mutex mtx;
+    unordered_map<Key, T, Hash, KeyEqual> map;
+  };
+
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::size_t size_type;
+
+  static constexpr size_type kDefaultShards = 64;
+
+  /* shards is rounded up to a power of two */
+  explicit concurrent_unordered_map(size_type shards = kDefaultShards)
+      : count{1}, bits{0}, shards{} {
+    while (count < shards) {
+      count *= 2;
+      ++bits;
+    }
+    this->shards.reset(new shard[count]);
+  }
+
+  concurrent_unordered_map(const concurrent_unordered_map&) = delete;
+  concurrent_unordered_map& operator=(const concurrent_unordered_map&) =
+      delete;
+
+  std::optional<T> find(const Key& key) const {
+    const shard& s = shard_for(key);
+    std::shared_lock<std::shared_mutex> lock(s.mtx);
+    auto it = s.map.find(key);
+    if (it == s.map.end()) return std::nullopt;
+    return it->second;
+  }
+
+  bool contains(const Key& key) const {
+    const shard& s = shard_for(key);
+    std::shared_lock<std::shared_mutex> lock(s.mtx);
+    return s.map.contains(key);
+  }
+
+  /* Returns true if key was absent */
+  bool insert(const Key& key, const T& obj) {
+    shard& s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mtx);
+    return s.map.try_emplace(key, obj).second;
+  }
+
+  /* Returns true if key was absent */
+  bool insert_or_assign(const Key& key, const T& obj) {
+    shard& s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mtx);
+    return s.map.insert_or_assign(key, obj).second;
+  }
+
+  /* Returns the value for key, storing make() first if key is absent. make
+   * runs under the shard lock, at most once per key, and must not use this
+   * map */
+  template <class F>
+  T compute_if_absent(const Key& key, F&& make) {
+    shard& s = shard_for(key);
+    {
+      std::shared_lock<std::shared_mutex> lock(s.mtx);
+      auto it = s.map.find(key);
+      if (it != s.map.end()) return it->second;
+    }
+    std::unique_lock<std::shared_mutex> lock(s.mtx);
+    auto it = s.map.find(key);
+    if (it == s.map.end()) it = s.map.try_emplace(key, make()).first;
+    return it->second;
+  }
+
+  /* Calls f(T&) on the value for key under the shard lock */
+  template <class F>
+  bool update(const Key& key, F&& f) {
+    shard& s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mtx);
+    auto it = s.map.find(key);
+    if (it == s.map.end()) return false;
+    f(it->second);
+    return true;
+  }
+
+  size_type erase(const Key& key) {
+    shard& s = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(s.mtx);
+    return s.map.erase(key);
+  }
+
+  /* Not a snapshot: shards are counted one after another */
+  size_type size() const {
+    size_type n = 0;
+    for (size_type i = 0; i < count; ++i) {
+      std::shared_lock<std::shared_mutex> lock(shards[i].mtx);
+      n += shards[i].map.size();
+    }
+    return n;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  void clear() {
+    for (size_type i = 0; i < count; ++i) {
+      std::unique_lock<std::shared_mutex> lock(shards[i].mtx);
+      shards[i].map.clear();
+    }
+  }
+
+  /* Spreads room for n elements evenly over the shards */
+  void reserve(size_type n) {
+    for (size_type i = 0; i < count; ++i) {
+      std::unique_lock<std::shared_mutex> lock(shards[i].mtx);
+      shards[i].map.reserve(n / count + 1);
+    }
+  }
+
+  size_type shard_count() const noexcept { return count; }
+
+ private:
+  // the shard takes the top bits of a Fibonacci hash; the shard's table
+  // mixes the hash again, so the two do not use correlated bits
+  size_type shard_index(const Key& key) const {
+    if (bits == 0) return 0;
+    std::uint64_t h = Hash()(key) * 0x9e3779b97f4a7c15ull;
+    return static_cast<size_type>(h >> (64 - bits));
+  }
+
+  shard& shard_for(const Key& key) { return shards[shard_index(key)]; }
+  const shard& shard_for(const Key& key) const {
+    return shards[shard_index(key)];
+  }
+
+  size_type count;
+  unsigned bits;
+  std::unique_ptr<shard[]> shards;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_CONCURRENT_UNORDERED_MAP_H_
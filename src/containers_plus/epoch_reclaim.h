@@ -0,0 +1,176 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_EPOCH_RECLAIM_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_EPOCH_RECLAIM_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* Epoch-based reclamation for lock-free containers.
+ *
+ * A thread reads shared nodes only inside a guard, which pins the global
+ * epoch it saw on entry. Unlinked nodes are retired with the epoch of their
+ * removal and freed once the global epoch is two steps ahead: by then every
+ * thread that could still hold a pointer has left its guard. The epoch
+ * advances only when all threads inside a guard have seen the current one.
+ *
+ * There is one process-wide domain. Nodes retired by a thread that exits
+ * are handed over to the domain and freed by other threads, or at exit.
+ */
+class epoch_domain {
+  struct retired {
+    void* ptr;
+    void (*deleter)(void*);
+    std::uint64_t epoch;
+  };
+
+  struct alignas(64) record {
+    std::atomic<std::uint64_t> state{0};  // 0 - outside of a guard
+    std::atomic<bool> in_use{true};
+    record* next = nullptr;
+    unsigned nesting = 0;
+    unsigned retire_count = 0;
+    vector<retired> limbo;
+  };
+
+  // binds a record to the current thread and returns it on thread exit
+  struct thread_slot {
+    record* rec = nullptr;
+    ~thread_slot() {
+      if (rec != nullptr) instance().release(rec);
+    }
+  };
+
+ public:
+  static constexpr unsigned kCollectPeriod = 64;
+
+  static epoch_domain& instance() {
+    static epoch_domain domain;
+    return domain;
+  }
+
+  epoch_domain(const epoch_domain&) = delete;
+  epoch_domain& operator=(const epoch_domain&) = delete;
+
+  ~epoch_domain() {
+    for (retired& r : orphans) r.deleter(r.ptr);
+    record* rec = records.load();
+    while (rec != nullptr) {
+      record* next = rec->next;
+      for (retired& r : rec->limbo) r.deleter(r.ptr);
+      delete rec;
+      rec = next;
+    }
+  }
+
+  /* Pins the current epoch for the calling thread; guards nest */
+  class guard {
+   public:
+    guard() : rec{instance().local()} { instance().enter(rec); }
+    guard(const guard&) : guard() {}
+    guard& operator=(const guard&) { return *this; }
+    ~guard() { instance().leave(rec); }
+
+   private:
+    record* rec;
+  };
+
+  /* Frees p with deleter once no guard can observe it */
+  void retire(void* p, void (*deleter)(void*)) {
+    record* rec = local();
+    rec->limbo.push_back(retired{p, deleter, global_epoch.load()});
+    if (++rec->retire_count % kCollectPeriod == 0) {
+      try_advance();
+      collect(rec);
+    }
+  }
+
+  template <class Node>
+  void retire(Node* p) {
+    retire(p, [](void* q) { delete static_cast<Node*>(q); });
+  }
+
+  std::uint64_t epoch() const { return global_epoch.load(); }
+
+ private:
+  epoch_domain() : global_epoch{1}, records{nullptr} {}
+
+  record* local() {
+    thread_local thread_slot slot;
+    if (slot.rec == nullptr) slot.rec = acquire();
+    return slot.rec;
+  }
+
+  record* acquire() {
+    for (record* rec = records.load(); rec != nullptr; rec = rec->next) {
+      bool expected = false;
+      if (!rec->in_use.load() &&
+          rec->in_use.compare_exchange_strong(expected, true))
+        return rec;
+    }
+    record* rec = new record;
+    rec->next = records.load();
+    while (!records.compare_exchange_weak(rec->next, rec)) {
+    }
+    return rec;
+  }
+
+  void release(record* rec) {
+    try_advance();
+    collect(rec);
+    if (!rec->limbo.empty()) {
+      std::lock_guard<std::mutex> lock(orphan_mtx);
+      for (retired& r : rec->limbo) orphans.push_back(r);
+      rec->limbo.clear();
+    }
+    rec->in_use.store(false);
+  }
+
+  void enter(record* rec) {
+    if (rec->nesting++ == 0) rec->state.store(global_epoch.load());
+  }
+
+  void leave(record* rec) {
+    if (--rec->nesting == 0) rec->state.store(0);
+  }
+
+  void try_advance() {
+    std::uint64_t e = global_epoch.load();
+    for (record* rec = records.load(); rec != nullptr; rec = rec->next) {
+      std::uint64_t s = rec->state.load();
+      if (s != 0 && s != e) return;
+    }
+    global_epoch.compare_exchange_strong(e, e + 1);
+  }
+
+  void collect(record* rec) {
+    std::uint64_t e = global_epoch.load();
+    free_expired(rec->limbo, e);
+
+    std::unique_lock<std::mutex> lock(orphan_mtx, std::try_to_lock);
+    if (lock.owns_lock()) free_expired(orphans, e);
+  }
+
+  static void free_expired(vector<retired>& list, std::uint64_t e) {
+    auto keep = list.begin();
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      if (it->epoch + 2 <= e)
+        it->deleter(it->ptr);
+      else
+        *keep++ = *it;
+    }
+    while (list.end() != keep) list.pop_back();
+  }
+
+  std::atomic<std::uint64_t> global_epoch;
+  std::atomic<record*> records;
+  std::mutex orphan_mtx;
+  vector<retired> orphans;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_EPOCH_RECLAIM_H_
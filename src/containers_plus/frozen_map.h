@@ -0,0 +1,122 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_FROZEN_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_FROZEN_MAP_H_
+
+#include "../containers/map.h"
+#include "frozen_set.h"
+
+namespace s21 {
+
+/* Immutable map built from an s21::map once it stops changing. Values are
+ * kept in a separate array indexed by the key's Eytzinger slot, so the
+ * search only streams keys through the cache.
+ */
+template <class Key, class T, class Compare = std::less<Key>>
+class frozen_map {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+
+  class const_iterator;
+  typedef const_iterator iterator;
+
+  frozen_map() : layout{}, values(1) {}
+
+  explicit frozen_map(const map<Key, T, Compare>& m) : layout{}, values(1) {
+    layout.assign(m.begin(), m.size());
+
+    vector<T> tmp(m.size() + 1);
+    auto it = m.begin();
+    for (size_type k = layout.begin(); k != 0; k = layout.next(k), ++it)
+      tmp[k] = it.get_ptr()->value;
+    values.swap(tmp);
+  }
+
+  const T& at(const Key& key) const {
+    size_type k = layout.find(key);
+    if (k == 0) throw std::out_of_range("frozen_map::at");
+    return values[k];
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(this, layout.begin());
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator end() const noexcept { return const_iterator(this, 0); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return layout.size() == 0; }
+  size_type size() const noexcept { return layout.size(); }
+
+  const_iterator find(const Key& key) const {
+    return const_iterator(this, layout.find(key));
+  }
+
+  bool contains(const Key& key) const { return layout.find(key) != 0; }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  const_iterator lower_bound(const Key& key) const {
+    return const_iterator(this, layout.lower_bound(key));
+  }
+
+  const_iterator upper_bound(const Key& key) const {
+    return const_iterator(this, layout.upper_bound(key));
+  }
+
+  class const_iterator {
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef Key value_type;
+    typedef const Key& reference;
+    typedef const Key* pointer;
+    typedef std::bidirectional_iterator_tag iterator_category;
+
+    const_iterator() : m{nullptr}, k{0} {}
+    const_iterator(const frozen_map* owner, size_type slot)
+        : m{owner}, k{slot} {}
+
+    bool operator==(const const_iterator& other) const { return k == other.k; }
+    bool operator!=(const const_iterator& other) const { return k != other.k; }
+
+    const_iterator& operator++() {
+      k = m->layout.next(k);
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp = *this;
+      k = m->layout.next(k);
+      return tmp;
+    }
+
+    const_iterator& operator--() {
+      k = m->layout.prev(k);
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp = *this;
+      k = m->layout.prev(k);
+      return tmp;
+    }
+
+    const Key& operator*() const { return m->layout[k]; }
+
+    const Key& key() const { return m->layout[k]; }
+    const T& value() const { return m->values[k]; }
+
+   private:
+    const frozen_map* m;
+    size_type k;
+  };
+
+ private:
+  eytzinger_layout<Key, Compare> layout;
+  vector<T> values;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_FROZEN_MAP_H_
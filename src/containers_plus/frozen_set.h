@@ -0,0 +1,209 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_FROZEN_SET_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_FROZEN_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+#include "../containers/set.h"
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* Keys of a sorted sequence stored in Eytzinger (BFS) order: the children of
+ * slot k are 2k and 2k + 1, slot 0 is unused and doubles as end(). The top
+ * levels of the implicit tree share a few cache lines and the descent is a
+ * fixed sequence of loads with no data-dependent branches.
+ */
+template <class Key, class Compare = std::less<Key>>
+class eytzinger_layout {
+ public:
+  typedef std::size_t size_type;
+
+  eytzinger_layout() : keys(1), n{0}, comp{} {}
+
+  /* Fills the layout from count keys given in ascending order */
+  template <class InputIt>
+  void assign(InputIt first, size_type count) {
+    vector<Key> tmp(count + 1);
+    n = count;
+    for (size_type k = begin(); k != 0; k = next(k), ++first) tmp[k] = *first;
+    keys.swap(tmp);
+  }
+
+  size_type size() const noexcept { return n; }
+
+  const Key& operator[](size_type k) const { return keys[k]; }
+
+  /* Slot of the first key not less than key, or 0 */
+  size_type lower_bound(const Key& key) const {
+    const Key* base = keys.data();
+    size_type k = 1;
+    while (k <= n) {
+      __builtin_prefetch(base + std::min(k * kPrefetchStride, n));
+      k = 2 * k + comp(base[k], key);
+    }
+    return k >> __builtin_ffsll(static_cast<long long>(~k));
+  }
+
+  /* Slot of the first key greater than key, or 0 */
+  size_type upper_bound(const Key& key) const {
+    const Key* base = keys.data();
+    size_type k = 1;
+    while (k <= n) {
+      __builtin_prefetch(base + std::min(k * kPrefetchStride, n));
+      k = 2 * k + !comp(key, base[k]);
+    }
+    return k >> __builtin_ffsll(static_cast<long long>(~k));
+  }
+
+  size_type find(const Key& key) const {
+    size_type k = lower_bound(key);
+    return k != 0 && !comp(key, keys[k]) ? k : 0;
+  }
+
+  /* In-order navigation over slots, 0 is past-the-end */
+  size_type begin() const noexcept {
+    if (n == 0) return 0;
+    size_type k = 1;
+    while (2 * k <= n) k = 2 * k;
+    return k;
+  }
+
+  size_type last() const noexcept {
+    if (n == 0) return 0;
+    size_type k = 1;
+    while (2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+
+  size_type next(size_type k) const noexcept {
+    if (2 * k + 1 <= n) {
+      k = 2 * k + 1;
+      while (2 * k <= n) k = 2 * k;
+      return k;
+    }
+    while (k & 1) k >>= 1;
+    return k >> 1;
+  }
+
+  size_type prev(size_type k) const noexcept {
+    if (k == 0) return last();
+    if (2 * k <= n) {
+      k = 2 * k;
+      while (2 * k + 1 <= n) k = 2 * k + 1;
+      return k;
+    }
+    while (k != 0 && !(k & 1)) k >>= 1;
+    return k >> 1;
+  }
+
+ private:
+  // slots 16k..16k+15 are the descendants of k four levels down; with 4-byte
+  // keys they fill exactly one cache line
+  static constexpr size_type kPrefetchStride =
+      sizeof(Key) >= 64 ? 1 : 64 / sizeof(Key);
+
+  vector<Key> keys;
+  size_type n;
+  Compare comp;
+};
+
+/* Immutable set built from an s21::set once it stops changing */
+template <class Key, class Compare = std::less<Key>>
+class frozen_set {
+ public:
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+
+  class const_iterator;
+  typedef const_iterator iterator;
+
+  frozen_set() : layout{} {}
+
+  explicit frozen_set(const set<Key, Compare>& s) : layout{} {
+    layout.assign(s.begin(), s.size());
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(&layout, layout.begin());
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator end() const noexcept { return const_iterator(&layout, 0); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return layout.size() == 0; }
+  size_type size() const noexcept { return layout.size(); }
+
+  const_iterator find(const Key& key) const {
+    return const_iterator(&layout, layout.find(key));
+  }
+
+  bool contains(const Key& key) const { return layout.find(key) != 0; }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  const_iterator lower_bound(const Key& key) const {
+    return const_iterator(&layout, layout.lower_bound(key));
+  }
+
+  const_iterator upper_bound(const Key& key) const {
+    return const_iterator(&layout, layout.upper_bound(key));
+  }
+
+  class const_iterator {
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef Key value_type;
+    typedef const Key& reference;
+    typedef const Key* pointer;
+    typedef std::bidirectional_iterator_tag iterator_category;
+
+    const_iterator() : l{nullptr}, k{0} {}
+    const_iterator(const eytzinger_layout<Key, Compare>* layout,
+                   size_type slot)
+        : l{layout}, k{slot} {}
+
+    bool operator==(const const_iterator& other) const { return k == other.k; }
+    bool operator!=(const const_iterator& other) const { return k != other.k; }
+
+    const_iterator& operator++() {
+      k = l->next(k);
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp = *this;
+      k = l->next(k);
+      return tmp;
+    }
+
+    const_iterator& operator--() {
+      k = l->prev(k);
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp = *this;
+      k = l->prev(k);
+      return tmp;
+    }
+
+    const Key& operator*() const { return (*l)[k]; }
+
+    size_type slot() const { return k; }
+
+   private:
+    const eytzinger_layout<Key, Compare>* l;
+    size_type k;
+  };
+
+ private:
+  eytzinger_layout<Key, Compare> layout;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_FROZEN_SET_H_
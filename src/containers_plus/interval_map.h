@@ -0,0 +1,146 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_INTERVAL_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_INTERVAL_MAP_H_
+
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/rb_tree.h"
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* Subtree summary of an interval tree: the largest right endpoint */
+template <class K>
+struct IntervalMaxAugment {
+  typedef std::pair<bool, K> value_type;  // {subtree is not empty, max hi}
+  static value_type identity() { return value_type(false, K()); }
+  static value_type combine(const value_type& a, const value_type& b) {
+    if (!a.first) return b;
+    if (!b.first) return a;
+    return a.second < b.second ? b : a;
+  }
+  template <class V>
+  static value_type lift(const std::pair<K, K>& key, const V&) {
+    return value_type(true, key.second);
+  }
+};
+
+/* Map from half-open intervals [lo, hi) to values. Intervals are ordered by
+ * (lo, hi) in an RBTree whose nodes also keep the largest hi of their
+ * subtree, so subtrees that end before the query are skipped.
+ */
+template <class K, class V>
+class interval_map {
+ public:
+  typedef std::pair<K, K> key_type;
+  typedef V mapped_type;
+  typedef RBTree<key_type, V, std::less<key_type>,
+                 std::allocator<RBNode<key_type, V>>, RBBalance,
+                 IntervalMaxAugment<K>>
+      rb_tree;
+  typedef typename rb_tree::size_type size_type;
+  typedef typename rb_tree::iterator iterator;
+  typedef typename rb_tree::const_iterator const_iterator;
+
+  interval_map() : tree{} {}
+
+  V& at(const K& lo, const K& hi) { return tree.at(key_type(lo, hi)); }
+
+  const V& at(const K& lo, const K& hi) const {
+    return tree.at(key_type(lo, hi));
+  }
+
+  iterator begin() noexcept { return tree.begin(); }
+  const_iterator begin() const noexcept { return tree.begin(); }
+  iterator end() noexcept { return tree.end(); }
+  const_iterator end() const noexcept { return tree.end(); }
+
+  bool empty() const noexcept { return tree.empty(); }
+  size_type size() const noexcept { return tree.size(); }
+  void clear() noexcept { tree.clear(); }
+
+  std::pair<iterator, bool> insert(const K& lo, const K& hi, const V& value) {
+    if (!(lo < hi)) throw std::invalid_argument("interval_map: empty interval");
+    return tree.insert(std::make_pair(key_type(lo, hi), value));
+  }
+
+  size_type erase(const K& lo, const K& hi) {
+    return tree.erase(key_type(lo, hi));
+  }
+
+  iterator find(const K& lo, const K& hi) {
+    return tree.find(key_type(lo, hi));
+  }
+
+  const_iterator find(const K& lo, const K& hi) const {
+    return tree.find(key_type(lo, hi));
+  }
+
+  /* Intervals that intersect [lo, hi), ordered by (lo, hi). The walk
+   * visits the paths from the root to the k matches, so it takes
+   * O(k log(n / k) + log n), not the O(log n + k) of a priority search
+   * structure */
+  vector<iterator> overlapping(const K& lo, const K& hi) {
+    vector<iterator> res;
+    if (lo < hi) collect(tree.get_root(), lo, hi, res);
+    return res;
+  }
+
+  vector<const_iterator> overlapping(const K& lo, const K& hi) const {
+    vector<const_iterator> res;
+    if (lo < hi) collect(tree.get_root(), lo, hi, res);
+    return res;
+  }
+
+  /* Intervals that contain point */
+  vector<iterator> stabbing(const K& point) {
+    vector<iterator> res;
+    stab(tree.get_root(), point, res);
+    return res;
+  }
+
+  vector<const_iterator> stabbing(const K& point) const {
+    vector<const_iterator> res;
+    stab(tree.get_root(), point, res);
+    return res;
+  }
+
+ private:
+  typedef typename rb_tree::node_type* node_ptr;
+
+  // no interval in the subtree ends after point
+  static bool endsBefore(node_ptr node, const K& point) {
+    return node == nullptr || !node->summary.first ||
+           !(point < node->summary.second);
+  }
+
+  template <class It>
+  static void collect(node_ptr node, const K& lo, const K& hi,
+                      vector<It>& res) {
+    if (endsBefore(node, lo)) return;
+
+    collect(node->left, lo, hi, res);
+    // further right only intervals that start no earlier than node
+    if (node->key.first < hi) {
+      if (lo < node->key.second) res.push_back(It(node));
+      collect(node->right, lo, hi, res);
+    }
+  }
+
+  template <class It>
+  static void stab(node_ptr node, const K& point, vector<It>& res) {
+    if (endsBefore(node, point)) return;
+
+    stab(node->left, point, res);
+    if (!(point < node->key.first)) {
+      if (point < node->key.second) res.push_back(It(node));
+      stab(node->right, point, res);
+    }
+  }
+
+  rb_tree tree;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_INTERVAL_MAP_H_
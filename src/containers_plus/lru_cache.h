@@ -0,0 +1,190 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_LRU_CACHE_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_LRU_CACHE_H_
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/list.h"
+#include "unordered_map.h"
+
+namespace s21 {
+
+/* Default weight of a cache entry: its inline size in bytes */
+struct lru_entry_size {
+  template <class Key, class T>
+  std::size_t operator()(const Key&, const T&) const {
+    return sizeof(Key) + sizeof(T);
+  }
+};
+
+/* Least-recently-used cache. Entries live in an s21::list ordered from the
+ * most to the least recently used one; an s21::unordered_map index maps
+ * keys to list nodes, so get/put/touch are O(1) and a promotion only
+ * relinks the node.
+ *
+ * The cache evicts from the cold end while it holds more than max_entries
+ * entries or their total Weigher weight exceeds max_weight. The entry that
+ * was just put is never evicted, even if it alone is over the budget.
+ */
+template <class Key, class T, class Weigher = lru_entry_size,
+          class Hash = std::hash<Key>>
+class lru_cache {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef list<value_type> list_type;
+  typedef typename list_type::iterator iterator;
+  typedef typename list_type::const_iterator const_iterator;
+
+  explicit lru_cache(
+      size_type max_entries,
+      size_type max_weight = std::numeric_limits<size_type>::max())
+      : entries{},
+        index{},
+        entry_limit{max_entries},
+        weight_limit{max_weight},
+        total_weight{0},
+        hit_count{0},
+        miss_count{0},
+        weigher{} {
+    if (max_entries == 0) throw std::invalid_argument("lru_cache: capacity 0");
+  }
+
+  /* The index of a copy is rebuilt over the copied list nodes */
+  lru_cache(const lru_cache& other)
+      : entries{other.entries},
+        index{},
+        entry_limit{other.entry_limit},
+        weight_limit{other.weight_limit},
+        total_weight{other.total_weight},
+        hit_count{other.hit_count},
+        miss_count{other.miss_count},
+        weigher{other.weigher} {
+    index.reserve(entries.size());
+    for (iterator it = entries.begin(); it != entries.end(); ++it)
+      index.try_emplace((*it).first, it);
+  }
+
+  lru_cache(lru_cache&& other) = default;
+
+  lru_cache& operator=(const lru_cache& other) {
+    if (this != &other) *this = lru_cache(other);
+    return *this;
+  }
+
+  lru_cache& operator=(lru_cache&& other) = default;
+
+  /* Value of key, promoted to most recently used, or nullptr. Counts a hit
+   * or a miss */
+  T* get(const Key& key) {
+    auto found = index.find(key);
+    if (found == index.end()) {
+      ++miss_count;
+      return nullptr;
+    }
+    ++hit_count;
+    promote(found->second);
+    return &found->second.get_ptr()->key.second;
+  }
+
+  /* Promotes key without reading it; false if it is not cached */
+  bool touch(const Key& key) {
+    auto found = index.find(key);
+    if (found == index.end()) return false;
+    promote(found->second);
+    return true;
+  }
+
+  /* Inserts or overwrites key and makes it the most recently used entry */
+  T& put(const Key& key, const T& value) {
+    auto found = index.find(key);
+    if (found != index.end()) {
+      // the weights are taken before the value changes, so a throwing
+      // weigher or assignment leaves total_weight matching the entries
+      value_type& entry = *found->second;
+      const size_type old_weight = weigher(entry.first, entry.second);
+      const size_type new_weight = weigher(entry.first, value);
+      entry.second = value;
+      total_weight = total_weight - old_weight + new_weight;
+      promote(found->second);
+    } else {
+      const size_type new_weight = weigher(key, value);
+      entries.push_front(value_type(key, value));
+      try {
+        index.try_emplace(key, entries.begin());
+      } catch (...) {
+        entries.pop_front();
+        throw;
+      }
+      total_weight += new_weight;
+    }
+    evict();
+    return entries.front().second;
+  }
+
+  bool contains(const Key& key) const { return index.count(key) != 0; }
+
+  size_type erase(const Key& key) {
+    auto found = index.find(key);
+    if (found == index.end()) return 0;
+    const value_type& entry = *found->second;
+    total_weight -= weigher(entry.first, entry.second);
+    entries.erase(found->second);
+    index.erase(found);
+    return 1;
+  }
+
+  void clear() {
+    entries.clear();
+    index.clear();
+    total_weight = 0;
+  }
+
+  /* From the most to the least recently used entry */
+  iterator begin() noexcept { return entries.begin(); }
+  const_iterator begin() const noexcept { return entries.begin(); }
+  iterator end() noexcept { return entries.end(); }
+  const_iterator end() const noexcept { return entries.end(); }
+
+  bool empty() const noexcept { return entries.empty(); }
+  size_type size() const noexcept { return entries.size(); }
+  size_type max_entries() const noexcept { return entry_limit; }
+  size_type max_weight() const noexcept { return weight_limit; }
+  size_type weight() const noexcept { return total_weight; }
+
+  size_type hits() const noexcept { return hit_count; }
+  size_type misses() const noexcept { return miss_count; }
+  void reset_stats() noexcept { hit_count = miss_count = 0; }
+
+ private:
+  void promote(iterator it) {
+    entries.splice(entries.cbegin(), entries, const_iterator(it.get_ptr()));
+  }
+
+  void evict() {
+    while (entries.size() > 1 &&
+           (entries.size() > entry_limit || total_weight > weight_limit)) {
+      value_type& victim = entries.back();
+      total_weight -= weigher(victim.first, victim.second);
+      index.erase(victim.first);
+      entries.pop_back();
+    }
+  }
+
+  list_type entries;
+  unordered_map<Key, iterator, Hash> index;
+  size_type entry_limit;
+  size_type weight_limit;
+  size_type total_weight;
+  size_type hit_count;
+  size_type miss_count;
+  Weigher weigher;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_LRU_CACHE_H_
@@ -0,0 +1,332 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_MAPPED_STATIC_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_MAPPED_STATIC_MAP_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../containers/map.h"
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* Read-only map over a file written from an s21::map.
+ *
+ * Layout: 64-byte header, then all keys in sorted order, then all values in
+ * the same order (each section aligned to 64 bytes). The file is mapped with
+ * MAP_SHARED, so nothing is copied on open and the page cache is shared
+ * between processes. Every index_stride()-th key is kept in memory, so a
+ * lookup touches the mapping only inside a single block of keys.
+ */
+template <class Key, class T, class Compare = std::less<Key>>
+class mapped_static_map {
+  static_assert(std::is_trivially_copyable<Key>::value,
+                "mapped_static_map key must be trivially copyable");
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mapped_static_map value must be trivially copyable");
+
+  struct file_header {
+    char magic[8];
+    std::uint64_t count;
+    std::uint32_t key_size;
+    std::uint32_t value_size;
+    std::uint64_t keys_offset;
+    std::uint64_t values_offset;
+    char reserved[24];
+  };
+
+  static_assert(sizeof(file_header) == 64, "header must fill one cache line");
+
+  static constexpr char kMagic[8] = {'S', '2', '1', 'S', 'M', 'A', 'P', '1'};
+  static constexpr std::size_t kMaxIndexSize = 1 << 16;
+  static constexpr std::size_t kMinStride = 64;
+
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+
+  class const_iterator;
+  typedef const_iterator iterator;
+
+  mapped_static_map() = default;
+
+  explicit mapped_static_map(const std::string& path) { open(path); }
+
+  mapped_static_map(const mapped_static_map&) = delete;
+  mapped_static_map& operator=(const mapped_static_map&) = delete;
+
+  mapped_static_map(mapped_static_map&& other) noexcept { swap(other); }
+
+  mapped_static_map& operator=(mapped_static_map&& other) noexcept {
+    if (this != &other) {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~mapped_static_map() { close(); }
+
+  /* Writes m to path in the layout expected by open() */
+  static void write(const std::string& path, const map<Key, T, Compare>& m) {
+    file_header h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.count = m.size();
+    h.key_size = sizeof(Key);
+    h.value_size = sizeof(T);
+    h.keys_offset = sizeof(file_header);
+    h.values_offset = align(h.keys_offset + h.count * sizeof(Key));
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("mapped_static_map::write: " + path);
+
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    for (auto it = m.begin(); it != m.end(); ++it)
+      out.write(reinterpret_cast<const char*>(&it.get_ptr()->key),
+                sizeof(Key));
+    pad(out, h.values_offset - (h.keys_offset + h.count * sizeof(Key)));
+    for (auto it = m.begin(); it != m.end(); ++it)
+      out.write(reinterpret_cast<const char*>(&it.get_ptr()->value),
+                sizeof(T));
+
+    if (!out) throw std::runtime_error("mapped_static_map::write: " + path);
+  }
+
+  void open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("mapped_static_map::open: " + path);
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<std::size_t>(st.st_size) < sizeof(file_header)) {
+      ::close(fd);
+      throw std::runtime_error("mapped_static_map::open: bad file " + path);
+    }
+
+    void* p = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+      throw std::runtime_error("mapped_static_map::open: mmap " + path);
+
+    base = p;
+    length = st.st_size;
+
+    const file_header* h = static_cast<const file_header*>(base);
+    if (!valid_header(*h, length)) {
+      close();
+      throw std::runtime_error("mapped_static_map::open: bad header " + path);
+    }
+
+    count = h->count;
+    keys = reinterpret_cast<const Key*>(static_cast<const char*>(base) +
+                                        h->keys_offset);
+    values = reinterpret_cast<const T*>(static_cast<const char*>(base) +
+                                        h->values_offset);
+    build_index();
+  }
+
+  void close() noexcept {
+    if (base != nullptr) ::munmap(base, length);
+    base = nullptr;
+    length = 0;
+    count = 0;
+    keys = nullptr;
+    values = nullptr;
+    index.clear();
+    stride = kMinStride;
+  }
+
+  bool is_open() const noexcept { return base != nullptr; }
+
+  const T& at(const Key& key) const {
+    size_type i = lower_index(key);
+    if (i == count || comp(key, keys[i]))
+      throw std::out_of_range("mapped_static_map::at");
+    return values[i];
+  }
+
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator end() const noexcept { return const_iterator(this, count); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return count == 0; }
+  size_type size() const noexcept { return count; }
+  size_type index_stride() const noexcept { return stride; }
+
+  const_iterator find(const Key& key) const {
+    size_type i = lower_index(key);
+    if (i == count || comp(key, keys[i])) return end();
+    return const_iterator(this, i);
+  }
+
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  const_iterator lower_bound(const Key& key) const {
+    return const_iterator(this, lower_index(key));
+  }
+
+  const_iterator upper_bound(const Key& key) const {
+    size_type i = lower_index(key);
+    if (i != count && !comp(key, keys[i])) ++i;
+    return const_iterator(this, i);
+  }
+
+  /* Range scan over keys in [lo, hi) */
+  std::pair<const_iterator, const_iterator> range(const Key& lo,
+                                                  const Key& hi) const {
+    return std::pair<const_iterator, const_iterator>(lower_bound(lo),
+                                                     lower_bound(hi));
+  }
+
+  void swap(mapped_static_map& other) noexcept {
+    std::swap(base, other.base);
+    std::swap(length, other.length);
+    std::swap(count, other.count);
+    std::swap(keys, other.keys);
+    std::swap(values, other.values);
+    std::swap(stride, other.stride);
+    index.swap(other.index);
+    std::swap(comp, other.comp);
+  }
+
+  class const_iterator {
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef Key value_type;
+    typedef const Key& reference;
+    typedef const Key* pointer;
+    typedef std::bidirectional_iterator_tag iterator_category;
+
+    const_iterator() : m{nullptr}, pos{0} {}
+    const_iterator(const mapped_static_map* owner, size_type p)
+        : m{owner}, pos{p} {}
+
+    bool operator==(const const_iterator& other) const {
+      return pos == other.pos && m == other.m;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+
+    const_iterator& operator++() {
+      ++pos;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator tmp = *this;
+      ++pos;
+      return tmp;
+    }
+
+    const_iterator& operator--() {
+      --pos;
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator tmp = *this;
+      --pos;
+      return tmp;
+    }
+
+    difference_type operator-(const const_iterator& other) const {
+      return static_cast<difference_type>(pos) -
+             static_cast<difference_type>(other.pos);
+    }
+
+    const Key& operator*() const { return m->keys[pos]; }
+
+    const Key& key() const { return m->keys[pos]; }
+    const T& value() const { return m->values[pos]; }
+
+   private:
+    const mapped_static_map* m;
+    size_type pos;
+  };
+
+ private:
+  static std::uint64_t align(std::uint64_t off) { return (off + 63) & ~63ull; }
+
+  /* Whether both sections lie inside a file of length bytes, in order,
+   * without overlapping the header and aligned for their types. Sizes are
+   * compared by division so a corrupt count cannot overflow. */
+  static bool valid_header(const file_header& h, std::uint64_t length) {
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 ||
+        h.key_size != sizeof(Key) || h.value_size != sizeof(T))
+      return false;
+    if (h.keys_offset < sizeof(file_header) || h.keys_offset > length ||
+        h.keys_offset % alignof(Key) != 0 ||
+        h.values_offset % alignof(T) != 0)
+      return false;
+    if (h.count > (length - h.keys_offset) / sizeof(Key)) return false;
+    std::uint64_t keys_end = h.keys_offset + h.count * sizeof(Key);
+    if (h.values_offset < keys_end || h.values_offset > length) return false;
+    return h.count <= (length - h.values_offset) / sizeof(T);
+  }
+
+  static void pad(std::ofstream& out, std::uint64_t n) {
+    static const char zeros[64] = {};
+    out.write(zeros, n);
+  }
+
+  void build_index() {
+    stride = kMinStride;
+    while (count / stride > kMaxIndexSize) stride *= 2;
+    index.reserve(count / stride + 1);
+    for (size_type i = 0; i < count; i += stride) index.push_back(keys[i]);
+  }
+
+  /* Index of the first key not less than key, or count */
+  size_type lower_index(const Key& key) const {
+    if (count == 0) return 0;
+
+    // the last block whose first key is not greater than key
+    size_type lo = 0, hi = index.size();
+    while (lo < hi) {
+      size_type mid = lo + (hi - lo) / 2;
+      if (comp(key, index[mid]))
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+    if (lo == 0) return 0;
+
+    size_type first = (lo - 1) * stride;
+    size_type last = std::min(first + stride, count);
+    while (first < last) {
+      size_type mid = first + (last - first) / 2;
+      if (comp(keys[mid], key))
+        first = mid + 1;
+      else
+        last = mid;
+    }
+    return first;
+  }
+
+  void* base = nullptr;
+  std::size_t length = 0;
+  size_type count = 0;
+  const Key* keys = nullptr;
+  const T* values = nullptr;
+  size_type stride = kMinStride;
+  vector<Key> index;
+  Compare comp;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_MAPPED_STATIC_MAP_H_
@@ -0,0 +1,130 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_MMAP_ALLOCATOR_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_MMAP_ALLOCATOR_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace s21 {
+
+/* Allocator that maps every block straight from the kernel with anonymous
+ * mmap, for multi-gigabyte arrays. It also provides reallocate(), so
+ * s21::vector of a trivially relocatable type grows and shrinks its buffer
+ * with mremap: the pages are moved by the page tables, nothing is copied,
+ * and shrink_to_fit hands the freed tail back to the OS.
+ *
+ * With HugePages, blocks of 2 MiB and more are madvise'd for transparent
+ * huge pages, which cuts TLB misses on large scans. The kernel may ignore
+ * the hint (THP set to "never").
+ */
+template <class T, bool HugePages = true>
+class mmap_allocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <class U>
+  struct rebind {
+    typedef mmap_allocator<U, HugePages> other;
+  };
+
+  static constexpr std::size_t kHugePageSize = std::size_t(2) << 20;
+
+  mmap_allocator() noexcept = default;
+
+  template <class U>
+  mmap_allocator(const mmap_allocator<U, HugePages>&) noexcept {}
+
+  T* allocate(size_type n) {
+    if (n == 0) return nullptr;
+    if (n > max_size()) throw std::bad_array_new_length();
+    std::size_t bytes = round_up(n * sizeof(T));
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    advise(p, bytes);
+    return static_cast<T*>(p);
+  }
+
+  void deallocate(T* p, size_type n) noexcept {
+    if (p != nullptr) ::munmap(p, round_up(n * sizeof(T)));
+  }
+
+  /* Resizes a block of old_n elements to new_n, keeping the contents up to
+   * the smaller size; the block may move */
+  T* reallocate(T* p, size_type old_n, size_type new_n) {
+    if (p == nullptr) return allocate(new_n);
+    if (new_n == 0) {
+      deallocate(p, old_n);
+      return nullptr;
+    }
+    if (new_n > max_size()) throw std::bad_array_new_length();
+    std::size_t old_bytes = round_up(old_n * sizeof(T));
+    std::size_t new_bytes = round_up(new_n * sizeof(T));
+    if (old_bytes == new_bytes) return p;
+#ifdef MREMAP_MAYMOVE
+    void* q = ::mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (q == MAP_FAILED) throw std::bad_alloc();
+    if (new_bytes > old_bytes) advise(q, new_bytes);
+    return static_cast<T*>(q);
+#else
+    if (new_bytes < old_bytes) {
+      ::munmap(reinterpret_cast<char*>(p) + new_bytes, old_bytes - new_bytes);
+      return p;
+    }
+    T* q = allocate(new_n);
+    std::memcpy((void*)q, (const void*)p, old_bytes);
+    ::munmap(p, old_bytes);
+    return q;
+#endif
+  }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+  }
+
+  static std::size_t page_size() noexcept {
+    static const std::size_t size = ::sysconf(_SC_PAGESIZE);
+    return size;
+  }
+
+ private:
+  static std::size_t round_up(std::size_t bytes) noexcept {
+    std::size_t page = page_size();
+    return (bytes + page - 1) / page * page;
+  }
+
+  static void advise(void* p, std::size_t bytes) noexcept {
+#ifdef MADV_HUGEPAGE
+    if (HugePages && bytes >= kHugePageSize) ::madvise(p, bytes, MADV_HUGEPAGE);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+  }
+};
+
+template <class T, class U, bool H>
+bool operator==(const mmap_allocator<T, H>&,
+                const mmap_allocator<U, H>&) noexcept {
+  return true;
+}
+
+template <class T, class U, bool H>
+bool operator!=(const mmap_allocator<T, H>&,
+                const mmap_allocator<U, H>&) noexcept {
+  return false;
+}
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_MMAP_ALLOCATOR_H_
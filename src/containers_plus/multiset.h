@@ -1,24 +1,29 @@
 #ifndef _MULTISET_H_
 #define _MULTISET_H_
 
+#include <type_traits>
+
 #include "../containers/rb_tree.h"
 
 namespace s21 {
 
-template <class Key, class Compare = std::less<Key>>
+template <class Key, class Compare = std::less<Key>,
+          class Balance = RBBalance, class Filter = NoFilter>
 class multiset {
  public:
   typedef char T;
-  typedef RBTree<Key, T, Compare> rb_tree;
-  typedef typename RBTree<Key, T, Compare>::key_type key_type;
-  typedef typename RBTree<Key, T, Compare>::key_type value_type;
-  typedef typename RBTree<Key, T, Compare>::size_type size_type;
-  typedef typename RBTree<Key, T, Compare>::key_compare key_compare;
-  typedef typename RBTree<Key, T, Compare>::allocator_type allocator_type;
-  typedef typename RBTree<Key, T, Compare>::reference reference;
-  typedef typename RBTree<Key, T, Compare>::const_reference const_reference;
-  typedef typename RBTree<Key, T, Compare>::iterator iterator;
-  typedef typename RBTree<Key, T, Compare>::const_iterator const_iterator;
+  typedef RBTree<Key, T, Compare, std::allocator<RBNode<Key, T>>, Balance,
+                 void, Filter>
+      rb_tree;
+  typedef typename rb_tree::key_type key_type;
+  typedef typename rb_tree::key_type value_type;
+  typedef typename rb_tree::size_type size_type;
+  typedef typename rb_tree::key_compare key_compare;
+  typedef typename rb_tree::allocator_type allocator_type;
+  typedef typename rb_tree::reference reference;
+  typedef typename rb_tree::const_reference const_reference;
+  typedef typename rb_tree::iterator iterator;
+  typedef typename rb_tree::const_iterator const_iterator;
 
   /* Member functions */
 
@@ -101,6 +106,22 @@ class multiset {
 
   void swap(multiset& other) noexcept { return tree.swap(other.tree); }
 
+  /* TreapBalance only: moves the keys not less than key into the result */
+  multiset split(const key_type& key) {
+    static_assert(std::is_same_v<Balance, TreapBalance>,
+                  "split/join need TreapBalance");
+    multiset rest;
+    rest.tree = tree.split(key);
+    return rest;
+  }
+
+  /* TreapBalance only: appends other, whose keys are not less than ours */
+  void join(multiset& other) {
+    static_assert(std::is_same_v<Balance, TreapBalance>,
+                  "split/join need TreapBalance");
+    tree.join(other.tree);
+  }
+
   iterator find(const Key& key) { return tree.find(key); }
 
   const_iterator find(const Key& key) const { return tree.find(key); }
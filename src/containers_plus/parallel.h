@@ -0,0 +1,315 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_PARALLEL_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_PARALLEL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "../containers/vector.h"
+#include "thread_pool.h"
+
+namespace s21 {
+
+/* Parallel versions of sort, for_each, transform, copy, reduce and
+ * inclusive_scan over iterators of contiguous containers (s21::vector,
+ * s21::array, small_vector).
+ *
+ * A range is cut into chunks of at least min_grain() elements, about four
+ * per thread so that work stealing can even out uneven chunks; a range of
+ * less than two chunks runs serially on the calling thread. The calling
+ * thread works on the chunks too, and waits by running queued tasks, so the
+ * algorithms may be nested. The first exception thrown by any chunk is
+ * rethrown once all chunks have finished.
+ *
+ * reduce and inclusive_scan combine partial results in range order, so op
+ * has to be associative but need not be commutative.
+ */
+namespace parallel {
+
+namespace pool {
+
+inline std::mutex& config_mutex() {
+  static std::mutex m;
+  return m;
+}
+
+inline std::unique_ptr<thread_pool>& holder() {
+  static std::unique_ptr<thread_pool> p;
+  return p;
+}
+
+inline std::atomic<std::size_t>& threads() {
+  static std::atomic<std::size_t> n{
+      std::max<std::size_t>(1, std::thread::hardware_concurrency())};
+  return n;
+}
+
+inline std::atomic<std::size_t>& grain() {
+  static std::atomic<std::size_t> g{1 << 12};
+  return g;
+}
+
+/* The library pool, created on first use with thread_count() - 1 workers:
+ * the calling thread is the last one */
+inline thread_pool& instance() {
+  std::lock_guard<std::mutex> lock(config_mutex());
+  std::unique_ptr<thread_pool>& p = holder();
+  if (!p) p = std::make_unique<thread_pool>(threads() - 1);
+  return *p;
+}
+
+}  // namespace pool
+
+inline std::size_t thread_count() noexcept { return pool::threads(); }
+
+/* Sets the number of threads the algorithms use, the calling one included;
+ * 0 means std::thread::hardware_concurrency(). Must not be called while an
+ * algorithm is running. */
+inline void set_thread_count(std::size_t n) {
+  if (n == 0)
+    n = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  std::lock_guard<std::mutex> lock(pool::config_mutex());
+  pool::holder().reset();
+  pool::threads() = n;
+}
+
+inline std::size_t min_grain() noexcept { return pool::grain(); }
+
+/* Smallest chunk, in elements, worth handing to another thread */
+inline void set_min_grain(std::size_t n) noexcept {
+  pool::grain() = std::max<std::size_t>(1, n);
+}
+
+/* Number of chunks to cut n elements into, 1 to stay serial */
+inline std::size_t chunk_count(std::size_t n) noexcept {
+  const std::size_t threads = thread_count();
+  const std::size_t grain = min_grain();
+  if (threads < 2 || n < 2 * grain) return 1;
+  return std::min(threads * 4, n / grain);
+}
+
+/* Runs body(i) for i in [0, chunks) on the pool and the calling thread */
+template <class Body>
+void run_chunks(std::size_t chunks, Body body) {
+  if (chunks <= 1) {
+    if (chunks == 1) body(std::size_t(0));
+    return;
+  }
+  thread_pool& workers = pool::instance();
+  std::atomic<std::size_t> remaining{chunks};
+  std::exception_ptr error;
+  std::mutex error_m;
+  auto run = [&](std::size_t i) {
+    try {
+      body(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_m);
+      if (!error) error = std::current_exception();
+    }
+    remaining.fetch_sub(1, std::memory_order_acq_rel);
+  };
+  std::size_t submitted = 1;
+  try {
+    for (; submitted < chunks; ++submitted)
+      workers.submit([&run, submitted] { run(submitted); });
+  } catch (...) {
+    // chunks that were not queued never run
+    remaining.fetch_sub(chunks - submitted, std::memory_order_acq_rel);
+    {
+      std::lock_guard<std::mutex> lock(error_m);
+      if (!error) error = std::current_exception();
+    }
+  }
+  run(0);
+  while (remaining.load(std::memory_order_acquire) != 0)
+    if (!workers.run_pending_task()) std::this_thread::yield();
+  if (error) std::rethrow_exception(error);
+}
+
+/* Bounds of chunk i out of chunks over n elements */
+inline std::pair<std::size_t, std::size_t> chunk_bounds(
+    std::size_t i, std::size_t chunks, std::size_t n) noexcept {
+  return {n * i / chunks, n * (i + 1) / chunks};
+}
+
+/* Address an iterator of a contiguous container points to; end() included,
+ * so it must not be dereferenced */
+template <class It>
+auto to_pointer(It it) {
+  if constexpr (std::is_pointer_v<It>)
+    return it;
+  else
+    return it.operator->();
+}
+
+template <class It>
+using value_t = std::remove_cv_t<
+    std::remove_pointer_t<decltype(to_pointer(std::declval<It>()))>>;
+
+template <class It, class F>
+void for_each(It first, It last, F f) {
+  const std::size_t n = to_pointer(last) - to_pointer(first);
+  if (n == 0) return;
+  auto p = to_pointer(first);
+  const std::size_t chunks = chunk_count(n);
+  run_chunks(chunks, [&](std::size_t i) {
+    auto [lo, hi] = chunk_bounds(i, chunks, n);
+    std::for_each(p + lo, p + hi, f);
+  });
+}
+
+template <class It, class Out, class UnaryOp>
+Out transform(It first, It last, Out d_first, UnaryOp op) {
+  const std::size_t n = to_pointer(last) - to_pointer(first);
+  if (n == 0) return d_first;
+  auto p = to_pointer(first);
+  auto d = to_pointer(d_first);
+  const std::size_t chunks = chunk_count(n);
+  run_chunks(chunks, [&](std::size_t i) {
+    auto [lo, hi] = chunk_bounds(i, chunks, n);
+    std::transform(p + lo, p + hi, d + lo, op);
+  });
+  return d_first + n;
+}
+
+template <class It, class Out>
+Out copy(It first, It last, Out d_first) {
+  const std::size_t n = to_pointer(last) - to_pointer(first);
+  if (n == 0) return d_first;
+  auto p = to_pointer(first);
+  auto d = to_pointer(d_first);
+  const std::size_t chunks = chunk_count(n);
+  run_chunks(chunks, [&](std::size_t i) {
+    auto [lo, hi] = chunk_bounds(i, chunks, n);
+    std::copy(p + lo, p + hi, d + lo);
+  });
+  return d_first + n;
+}
+
+template <class It, class T, class BinaryOp>
+T reduce(It first, It last, T init, BinaryOp op) {
+  const std::size_t n = to_pointer(last) - to_pointer(first);
+  if (n == 0) return init;
+  auto p = to_pointer(first);
+  const std::size_t chunks = chunk_count(n);
+  vector<std::optional<T>> partial(chunks, std::nullopt);
+  run_chunks(chunks, [&](std::size_t i) {
+    auto [lo, hi] = chunk_bounds(i, chunks, n);
+    T acc = p[lo];
+    for (std::size_t k = lo + 1; k < hi; ++k) acc = op(std::move(acc), p[k]);
+    partial[i] = std::move(acc);
+  });
+  for (std::size_t i = 0; i < chunks; ++i)
+    init = op(std::move(init), std::move(*partial[i]));
+  return init;
+}
+
+template <class It, class T>
+T reduce(It first, It last, T init) {
+  return parallel::reduce(first, last, std::move(init), std::plus<>());
+}
+
+/* Two passes: each chunk is summed, the sums are scanned serially, then
+ * every chunk is scanned on top of the total of the chunks before it */
+template <class It, class Out, class BinaryOp>
+Out inclusive_scan(It first, It last, Out d_first, BinaryOp op) {
+  typedef value_t<It> T;
+  const std::size_t n = to_pointer(last) - to_pointer(first);
+  if (n == 0) return d_first;
+  auto p = to_pointer(first);
+  auto d = to_pointer(d_first);
+  const std::size_t chunks = chunk_count(n);
+  if (chunks == 1) {
+    std::partial_sum(p, p + n, d, op);
+    return d_first + n;
+  }
+  vector<std::optional<T>> carry(chunks, std::nullopt);
+  run_chunks(chunks - 1, [&](std::size_t i) {
+    auto [lo, hi] = chunk_bounds(i, chunks, n);
+    T acc = p[lo];
+    for (std::size_t k = lo + 1; k < hi; ++k) acc = op(std::move(acc), p[k]);
+    carry[i + 1] = std::move(acc);
+  });
+  for (std::size_t i = 2; i < chunks; ++i)
+    carry[i] = op(std::move(*carry[i - 1]), std::move(*carry[i]));
+  run_chunks(chunks, [&](std::size_t i) {
+    auto [lo, hi] = chunk_bounds(i, chunks, n);
+    T acc = i == 0 ? T(p[lo]) : op(*carry[i], p[lo]);
+    d[lo] = acc;
+    for (std::size_t k = lo + 1; k < hi; ++k) {
+      acc = op(std::move(acc), p[k]);
+      d[k] = acc;
+    }
+  });
+  return d_first + n;
+}
+
+template <class It, class Out>
+Out inclusive_scan(It first, It last, Out d_first) {
+  return parallel::inclusive_scan(first, last, d_first, std::plus<>());
+}
+
+/* Merge sort: the chunks are sorted in parallel, then merged pairwise in
+ * rounds that ping-pong between the range and one buffer of its size */
+template <class It, class Compare>
+void sort(It first, It last, Compare comp) {
+  typedef value_t<It> T;
+  const std::size_t n = to_pointer(last) - to_pointer(first);
+  if (n < 2) return;
+  auto p = to_pointer(first);
+  const std::size_t chunks = chunk_count(n);
+  if (chunks == 1) {
+    std::sort(p, p + n, comp);
+    return;
+  }
+  run_chunks(chunks, [&](std::size_t i) {
+    auto [lo, hi] = chunk_bounds(i, chunks, n);
+    std::sort(p + lo, p + hi, comp);
+  });
+
+  vector<T> buffer(std::make_move_iterator(p), std::make_move_iterator(p + n));
+  T* src = buffer.data();
+  T* dst = p;
+  for (std::size_t width = 1; width < chunks; width *= 2) {
+    const std::size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+    run_chunks(pairs, [&](std::size_t k) {
+      const std::size_t lo = chunk_bounds(2 * k * width, chunks, n).first;
+      const std::size_t mid =
+          chunk_bounds(std::min(2 * k * width + width, chunks), chunks, n)
+              .first;
+      const std::size_t hi =
+          chunk_bounds(std::min(2 * k * width + 2 * width, chunks), chunks, n)
+              .first;
+      std::merge(std::make_move_iterator(src + lo),
+                 std::make_move_iterator(src + mid),
+                 std::make_move_iterator(src + mid),
+                 std::make_move_iterator(src + hi), dst + lo, comp);
+    });
+    std::swap(src, dst);
+  }
+  if (src != p) {
+    run_chunks(chunks, [&](std::size_t i) {
+      auto [lo, hi] = chunk_bounds(i, chunks, n);
+      std::move(src + lo, src + hi, p + lo);
+    });
+  }
+}
+
+template <class It>
+void sort(It first, It last) {
+  parallel::sort(first, last, std::less<>());
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_PARALLEL_H_
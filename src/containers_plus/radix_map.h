@@ -0,0 +1,981 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_RADIX_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_RADIX_MAP_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* Maps a key to a byte string whose lexicographic order is the key order.
+ * encoded must be cheap to build: it is created on every lookup.
+ */
+template <class Key, class = void>
+struct radix_key_traits;
+
+template <>
+struct radix_key_traits<std::string> {
+  class encoded {
+   public:
+    explicit encoded(const std::string& key)
+        : p{reinterpret_cast<const unsigned char*>(key.data())},
+          n{key.size()} {}
+    const unsigned char* data() const { return p; }
+    std::size_t size() const { return n; }
+
+   private:
+    const unsigned char* p;
+    std::size_t n;
+  };
+};
+
+/* Integers are stored big-endian with the sign bit flipped */
+template <class Key>
+struct radix_key_traits<Key, typename std::enable_if<
+                                 std::is_integral<Key>::value &&
+                                 !std::is_same<Key, bool>::value>::type> {
+  class encoded {
+   public:
+    explicit encoded(Key key) {
+      typedef typename std::make_unsigned<Key>::type U;
+      U u = static_cast<U>(key);
+      if (std::is_signed<Key>::value) u ^= U(1) << (sizeof(Key) * 8 - 1);
+      for (std::size_t i = 0; i < sizeof(Key); ++i)
+        b[i] = static_cast<unsigned char>(u >> (8 * (sizeof(Key) - 1 - i)));
+    }
+    const unsigned char* data() const { return b; }
+    std::size_t size() const { return sizeof(Key); }
+
+   private:
+    unsigned char b[sizeof(Key)];
+  };
+};
+
+/* Adaptive radix tree (Leis et al., ICDE 2013). Inner nodes branch on one
+ * byte of the encoded key and come in four sizes (4, 16, 48 and 256
+ * children) that grow and shrink with their fan-out. A node compresses the
+ * bytes shared by its whole subtree into its prefix, and a key that ends at
+ * a node lives in the node's terminal leaf. Leaves hang as soon as their key
+ * is unique (lazy expansion) and hold the whole key, which is compared once
+ * at the end of a lookup. Lookups cost O(key length) and never re-scan the
+ * shared prefix.
+ *
+ * A node keeps the length of its prefix and only its first kMaxPrefix bytes
+ * (the hybrid scheme of the paper): lookups compare those and skip the
+ * rest, which the final key compare checks, and updates read the rest from
+ * any leaf below the node. So no node owns a heap block besides itself.
+ *
+ * Memory is not much below map's for string keys. Iterators hand out a
+ * value_type&, so every leaf holds a full Key, and for URL-like keys the
+ * string's own heap copy is most of the cost in both containers. The
+ * saving is in the nodes, which is where integer keys gain; the "radix"
+ * bench section measures both.
+ */
+template <class Key, class T, class Traits = radix_key_traits<Key>>
+class radix_map {
+  typedef typename Traits::encoded encoded;
+
+  enum node_type : std::uint8_t { kNode4, kNode16, kNode48, kNode256 };
+
+  struct node {
+    explicit node(node_type t) : type{t} {}
+    node_type type;
+  };
+
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+
+ private:
+  // A leaf has no header: a child pointer to it carries the low bit, which
+  // is free since new aligns every block to at least 2
+  struct leaf {
+    template <class... Args>
+    explicit leaf(const Key& key, Args&&... args)
+        : kv{std::piecewise_construct, std::forward_as_tuple(key),
+             std::forward_as_tuple(std::forward<Args>(args)...)} {}
+    value_type kv;
+  };
+
+  static bool is_leaf(const node* n) {
+    return reinterpret_cast<std::uintptr_t>(n) & 1;
+  }
+  static leaf* as_leaf(const node* n) {
+    return reinterpret_cast<leaf*>(reinterpret_cast<std::uintptr_t>(n) - 1);
+  }
+  static node* leaf_ref(leaf* l) {
+    return reinterpret_cast<node*>(reinterpret_cast<std::uintptr_t>(l) + 1);
+  }
+
+  static constexpr std::size_t kMaxPrefix = 8;
+
+  struct inner : node {
+    explicit inner(node_type t)
+        : node{t}, count{0}, prefix_len{0}, term{nullptr}, prefix{} {}
+    std::uint16_t count;
+    std::uint32_t prefix_len;
+    leaf* term;
+    unsigned char prefix[kMaxPrefix];  // the first bytes of the prefix
+  };
+
+  struct node4 : inner {
+    node4() : inner{kNode4}, keys{}, child{} {}
+    unsigned char keys[4];
+    node* child[4];
+  };
+
+  struct node16 : inner {
+    node16() : inner{kNode16}, keys{}, child{} {}
+    alignas(16) unsigned char keys[16];
+    node* child[16];
+  };
+
+  struct node48 : inner {
+    node48() : inner{kNode48}, index{}, child{} {}
+    unsigned char index[256];  // 0 - no child, otherwise slot + 1
+    node* child[48];
+  };
+
+  struct node256 : inner {
+    node256() : inner{kNode256}, child{} {}
+    node* child[256];
+  };
+
+  struct frame {
+    const inner* n;
+    int next;  // the next byte to visit
+  };
+
+ public:
+  template <bool Const>
+  class basic_iterator;
+  typedef basic_iterator<false> iterator;
+  typedef basic_iterator<true> const_iterator;
+
+  radix_map() : root{nullptr}, sz{0} {}
+
+  radix_map(std::initializer_list<value_type> init) : radix_map() {
+    for (const value_type& v : init) insert(v);
+  }
+
+  radix_map(const radix_map& other)
+      : root{copy_node(other.root)}, sz{other.sz} {}
+
+  radix_map(radix_map&& other) noexcept : radix_map() { swap(other); }
+
+  radix_map& operator=(const radix_map& other) {
+    if (this != &other) {
+      radix_map tmp{other};
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  radix_map& operator=(radix_map&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~radix_map() { clear(); }
+
+  T& at(const Key& key) {
+    leaf* l = find_leaf(key);
+    if (l == nullptr) throw std::out_of_range("radix_map::at");
+    return l->kv.second;
+  }
+
+  const T& at(const Key& key) const {
+    const leaf* l = find_leaf(key);
+    if (l == nullptr) throw std::out_of_range("radix_map::at");
+    return l->kv.second;
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+  iterator begin() noexcept {
+    iterator it;
+    if (root != nullptr) it.leftmost(root);
+    return it;
+  }
+  const_iterator begin() const noexcept {
+    const_iterator it;
+    if (root != nullptr) it.leftmost(root);
+    return it;
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return iterator(); }
+  const_iterator end() const noexcept { return const_iterator(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return sz == 0; }
+  size_type size() const noexcept { return sz; }
+
+  void clear() noexcept {
+    destroy(root);
+    root = nullptr;
+    sz = 0;
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    std::pair<iterator, bool> res = try_emplace(key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+
+  /* Constructs the value from args only if key is absent */
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    encoded e(key);
+    std::pair<leaf*, bool> res =
+        emplace_leaf(key, e, std::forward<Args>(args)...);
+    return std::make_pair(iterator(res.first, this), res.second);
+  }
+
+  size_type erase(const Key& key);
+
+  void swap(radix_map& other) noexcept {
+    std::swap(root, other.root);
+    std::swap(sz, other.sz);
+  }
+
+  iterator find(const Key& key) {
+    leaf* l = find_leaf(key);
+    return l != nullptr ? iterator(l, this) : end();
+  }
+
+  const_iterator find(const Key& key) const {
+    leaf* l = find_leaf(key);
+    return l != nullptr ? const_iterator(l, this) : end();
+  }
+
+  bool contains(const Key& key) const { return find_leaf(key) != nullptr; }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key& key) {
+    encoded e(key);
+    return lower_bound_bytes<false>(e.data(), e.size());
+  }
+
+  const_iterator lower_bound(const Key& key) const {
+    encoded e(key);
+    return lower_bound_bytes<true>(e.data(), e.size());
+  }
+
+  iterator upper_bound(const Key& key) {
+    iterator it = lower_bound(key);
+    if (it != end() && equal(encoded(it->first), encoded(key))) ++it;
+    return it;
+  }
+
+  const_iterator upper_bound(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    if (it != end() && equal(encoded(it->first), encoded(key))) ++it;
+    return it;
+  }
+
+  /* All keys whose encoding starts with that of prefix */
+  std::pair<const_iterator, const_iterator> prefix_range(
+      const Key& prefix) const {
+    encoded e(prefix);
+    std::string upper(reinterpret_cast<const char*>(e.data()), e.size());
+    while (!upper.empty() && static_cast<unsigned char>(upper.back()) == 0xff)
+      upper.pop_back();
+    const_iterator last = end();
+    if (!upper.empty()) {
+      upper.back() = static_cast<char>(upper.back() + 1);
+      last = lower_bound_bytes<true>(
+          reinterpret_cast<const unsigned char*>(upper.data()), upper.size());
+    }
+    return std::make_pair(lower_bound_bytes<true>(e.data(), e.size()), last);
+  }
+
+  template <bool Const>
+  class basic_iterator {
+    friend class radix_map;
+    template <bool>
+    friend class basic_iterator;
+
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef std::pair<const Key, T> value_type;
+    typedef typename std::conditional<Const, const value_type&,
+                                      value_type&>::type reference;
+    typedef typename std::conditional<Const, const value_type*,
+                                      value_type*>::type pointer;
+    typedef std::forward_iterator_tag iterator_category;
+
+    basic_iterator() : cur{nullptr}, owner{nullptr}, stack{} {}
+
+    // iterator -> const_iterator
+    template <bool C = Const, class = typename std::enable_if<C>::type>
+    basic_iterator(const basic_iterator<false>& other)
+        : cur{other.cur}, owner{other.owner}, stack{other.stack} {}
+
+    bool operator==(const basic_iterator& other) const {
+      return cur == other.cur;
+    }
+    bool operator!=(const basic_iterator& other) const {
+      return cur != other.cur;
+    }
+
+    basic_iterator& operator++() {
+      advance();
+      return *this;
+    }
+
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      advance();
+      return tmp;
+    }
+
+    reference operator*() const { return cur->kv; }
+    pointer operator->() const { return &cur->kv; }
+
+   private:
+    // an iterator from find() or try_emplace(): the path to l is walked
+    // only if the iterator is advanced
+    basic_iterator(leaf* l, const radix_map* m)
+        : cur{l}, owner{m}, stack{} {}
+
+    // the smallest key in the subtree of n
+    void leftmost(const node* n) {
+      while (!is_leaf(n)) {
+        const inner* in = static_cast<const inner*>(n);
+        if (in->term != nullptr) {
+          stack.push_back(frame{in, 0});
+          cur = in->term;
+          return;
+        }
+        std::pair<int, node*> c = child_from(in, 0);
+        stack.push_back(frame{in, c.first + 1});
+        n = c.second;
+      }
+      cur = as_leaf(n);
+    }
+
+    // the first key after the subtrees already visited on the stack
+    void advance() {
+      if (owner != nullptr) {
+        encoded e(cur->kv.first);
+        *this = owner->template lower_bound_bytes<Const>(e.data(), e.size());
+      }
+      while (!stack.empty()) {
+        frame& top = stack[stack.size() - 1];
+        std::pair<int, node*> c =
+            top.next > 255 ? std::make_pair(-1, static_cast<node*>(nullptr))
+                           : child_from(top.n, top.next);
+        if (c.second != nullptr) {
+          top.next = c.first + 1;
+          leftmost(c.second);
+          return;
+        }
+        stack.pop_back();
+      }
+      cur = nullptr;
+    }
+
+    leaf* cur;
+    const radix_map* owner;  // set while the stack is not built yet
+    vector<frame> stack;
+  };
+
+ private:
+  static bool equal(const encoded& a, const encoded& b) {
+    return a.size() == b.size() &&
+           std::memcmp(a.data(), b.data(), a.size()) == 0;
+  }
+
+  // -1, 0 or 1 as a compares to b lexicographically
+  static int compare(const unsigned char* a, std::size_t an,
+                     const unsigned char* b, std::size_t bn) {
+    int c = std::memcmp(a, b, std::min(an, bn));
+    if (c != 0) return c < 0 ? -1 : 1;
+    return an < bn ? -1 : an > bn ? 1 : 0;
+  }
+
+  // the smallest leaf below in; every leaf below it spells out its prefix
+  static const leaf* min_leaf(const inner* in) {
+    while (in->term == nullptr) {
+      node* c = child_from(in, 0).second;
+      if (is_leaf(c)) return as_leaf(c);
+      in = static_cast<const inner*>(c);
+    }
+    return in->term;
+  }
+
+  // length of the common part of the prefix of in, whose path ends at
+  // depth, and k[0, n)
+  static std::size_t match(const inner* in, const unsigned char* k,
+                           std::size_t n, std::size_t depth) {
+    const std::size_t m = std::min<std::size_t>(in->prefix_len, n);
+    const std::size_t stored = std::min(m, kMaxPrefix);
+    std::size_t i = std::mismatch(in->prefix, in->prefix + stored, k).first -
+                    in->prefix;
+    if (i < stored || i == m) return i;
+    encoded le(min_leaf(in)->kv.first);
+    const unsigned char* full = le.data() + depth;
+    while (i < m && full[i] == k[i]) ++i;
+    return i;
+  }
+
+  // byte i of the prefix of in, whose path ends at depth
+  static unsigned char prefix_byte(const inner* in, std::size_t depth,
+                                   std::size_t i) {
+    if (i < kMaxPrefix) return in->prefix[i];
+    encoded le(min_leaf(in)->kv.first);
+    return le.data()[depth + i];
+  }
+
+  static void set_prefix(inner* in, const unsigned char* p, std::size_t n) {
+    in->prefix_len = static_cast<std::uint32_t>(n);
+    std::memcpy(in->prefix, p, std::min(n, kMaxPrefix));
+  }
+
+  static void copy_prefix(inner* to, const inner* from) {
+    to->prefix_len = from->prefix_len;
+    std::memcpy(to->prefix, from->prefix, kMaxPrefix);
+  }
+
+  // drops the first n bytes of the prefix of in, whose path ends at depth
+  static void cut_prefix(inner* in, std::size_t depth, std::size_t n) {
+    const std::size_t rest = in->prefix_len - n;
+    if (in->prefix_len <= kMaxPrefix) {
+      std::memmove(in->prefix, in->prefix + n, rest);
+    } else {
+      encoded le(min_leaf(in)->kv.first);
+      std::memcpy(in->prefix, le.data() + depth + n,
+                  std::min(rest, kMaxPrefix));
+    }
+    in->prefix_len = static_cast<std::uint32_t>(rest);
+  }
+
+  // puts the prefix of in and the byte b in front of the prefix of child
+  static void merge_prefix(const inner* in, unsigned char b, inner* child) {
+    unsigned char buf[kMaxPrefix];
+    std::size_t n = std::min<std::size_t>(in->prefix_len, kMaxPrefix);
+    std::memcpy(buf, in->prefix, n);
+    if (n < kMaxPrefix) buf[n++] = b;
+    const std::size_t rest = std::min<std::size_t>(
+        kMaxPrefix - n, std::min<std::size_t>(child->prefix_len, kMaxPrefix));
+    std::memcpy(buf + n, child->prefix, rest);
+    std::memcpy(child->prefix, buf, n + rest);
+    child->prefix_len += in->prefix_len + 1;
+  }
+
+  static node** find_child(inner* in, unsigned char b) {
+    switch (in->type) {
+      case kNode4: {
+        node4* n = static_cast<node4*>(in);
+        for (int i = 0; i < n->count; ++i)
+          if (n->keys[i] == b) return &n->child[i];
+        return nullptr;
+      }
+      case kNode16: {
+        node16* n = static_cast<node16*>(in);
+#ifdef __SSE2__
+        unsigned m = _mm_movemask_epi8(_mm_cmpeq_epi8(
+                         _mm_set1_epi8(static_cast<char>(b)),
+                         _mm_load_si128(
+                             reinterpret_cast<const __m128i*>(n->keys)))) &
+                     ((1u << n->count) - 1);
+        return m != 0 ? &n->child[__builtin_ctz(m)] : nullptr;
+#else
+        for (int i = 0; i < n->count; ++i)
+          if (n->keys[i] == b) return &n->child[i];
+        return nullptr;
+#endif
+      }
+      case kNode48: {
+        node48* n = static_cast<node48*>(in);
+        return n->index[b] != 0 ? &n->child[n->index[b] - 1] : nullptr;
+      }
+      default: {
+        node256* n = static_cast<node256*>(in);
+        return n->child[b] != nullptr ? &n->child[b] : nullptr;
+      }
+    }
+  }
+
+  // the child with the smallest byte not less than from
+  static std::pair<int, node*> child_from(const inner* in, int from) {
+    switch (in->type) {
+      case kNode4:
+      case kNode16: {
+        const unsigned char* keys =
+            in->type == kNode4 ? static_cast<const node4*>(in)->keys
+                               : static_cast<const node16*>(in)->keys;
+        node* const* child = in->type == kNode4
+                                 ? static_cast<const node4*>(in)->child
+                                 : static_cast<const node16*>(in)->child;
+        for (int i = 0; i < in->count; ++i)
+          if (keys[i] >= from) return std::make_pair(int(keys[i]), child[i]);
+        break;
+      }
+      case kNode48: {
+        const node48* n = static_cast<const node48*>(in);
+        for (int b = from; b < 256; ++b)
+          if (n->index[b] != 0)
+            return std::make_pair(b, n->child[n->index[b] - 1]);
+        break;
+      }
+      default: {
+        const node256* n = static_cast<const node256*>(in);
+        for (int b = from; b < 256; ++b)
+          if (n->child[b] != nullptr) return std::make_pair(b, n->child[b]);
+        break;
+      }
+    }
+    return std::make_pair(-1, static_cast<node*>(nullptr));
+  }
+
+  static int capacity(const inner* in) {
+    return in->type == kNode4    ? 4
+           : in->type == kNode16 ? 16
+           : in->type == kNode48 ? 48
+                                 : 256;
+  }
+
+  // moves the header and children of from into a node of type to
+  static inner* retype(inner* from, node_type to) {
+    inner* n;
+    switch (to) {
+      case kNode4:
+        n = new node4;
+        break;
+      case kNode16:
+        n = new node16;
+        break;
+      case kNode48:
+        n = new node48;
+        break;
+      default:
+        n = new node256;
+        break;
+    }
+    copy_prefix(n, from);
+    n->term = from->term;
+    for (std::pair<int, node*> c = child_from(from, 0); c.second != nullptr;
+         c = c.first == 255 ? std::make_pair(-1, static_cast<node*>(nullptr))
+                            : child_from(from, c.first + 1))
+      put_child(n, static_cast<unsigned char>(c.first), c.second);
+    delete_inner(from);
+    return n;
+  }
+
+  // adds a child to a node with room for it
+  static void put_child(inner* in, unsigned char b, node* child) {
+    switch (in->type) {
+      case kNode4:
+      case kNode16: {
+        unsigned char* keys = in->type == kNode4
+                                  ? static_cast<node4*>(in)->keys
+                                  : static_cast<node16*>(in)->keys;
+        node** children = in->type == kNode4 ? static_cast<node4*>(in)->child
+                                             : static_cast<node16*>(in)->child;
+        int i = in->count;
+        for (; i > 0 && keys[i - 1] > b; --i) {
+          keys[i] = keys[i - 1];
+          children[i] = children[i - 1];
+        }
+        keys[i] = b;
+        children[i] = child;
+        break;
+      }
+      case kNode48: {
+        node48* n = static_cast<node48*>(in);
+        int slot = 0;
+        while (n->child[slot] != nullptr) ++slot;
+        n->child[slot] = child;
+        n->index[b] = static_cast<unsigned char>(slot + 1);
+        break;
+      }
+      default:
+        static_cast<node256*>(in)->child[b] = child;
+        break;
+    }
+    ++in->count;
+  }
+
+  static void add_child(node*& ref, unsigned char b, node* child) {
+    inner* in = static_cast<inner*>(ref);
+    if (in->count == capacity(in)) {
+      in = retype(in, static_cast<node_type>(in->type + 1));
+      ref = in;
+    }
+    put_child(in, b, child);
+  }
+
+  static void drop_child(inner* in, unsigned char b) {
+    switch (in->type) {
+      case kNode4:
+      case kNode16: {
+        unsigned char* keys = in->type == kNode4
+                                  ? static_cast<node4*>(in)->keys
+                                  : static_cast<node16*>(in)->keys;
+        node** children = in->type == kNode4 ? static_cast<node4*>(in)->child
+                                             : static_cast<node16*>(in)->child;
+        int i = 0;
+        while (keys[i] != b) ++i;
+        for (; i + 1 < in->count; ++i) {
+          keys[i] = keys[i + 1];
+          children[i] = children[i + 1];
+        }
+        break;
+      }
+      case kNode48: {
+        node48* n = static_cast<node48*>(in);
+        n->child[n->index[b] - 1] = nullptr;
+        n->index[b] = 0;
+        break;
+      }
+      default:
+        static_cast<node256*>(in)->child[b] = nullptr;
+        break;
+    }
+    --in->count;
+  }
+
+  // restores the invariants of ref after it lost an entry: an inner node
+  // keeps at least two entries and the smallest type that fits them
+  static void shrink(node*& ref) {
+    inner* in = static_cast<inner*>(ref);
+    if (in->count + (in->term != nullptr) == 1) {
+      if (in->term != nullptr) {
+        ref = leaf_ref(in->term);
+      } else {
+        std::pair<int, node*> c = child_from(in, 0);
+        if (!is_leaf(c.second))
+          merge_prefix(in, static_cast<unsigned char>(c.first),
+                       static_cast<inner*>(c.second));
+        ref = c.second;
+      }
+      delete_inner(in);
+    } else if ((in->type == kNode16 && in->count <= 3) ||
+               (in->type == kNode48 && in->count <= 12) ||
+               (in->type == kNode256 && in->count <= 37)) {
+      ref = retype(in, static_cast<node_type>(in->type - 1));
+    }
+  }
+
+  static void delete_inner(inner* in) {
+    switch (in->type) {
+      case kNode4:
+        delete static_cast<node4*>(in);
+        break;
+      case kNode16:
+        delete static_cast<node16*>(in);
+        break;
+      case kNode48:
+        delete static_cast<node48*>(in);
+        break;
+      default:
+        delete static_cast<node256*>(in);
+        break;
+    }
+  }
+
+  static void destroy(node* n) {
+    if (n == nullptr) return;
+    if (is_leaf(n)) {
+      delete as_leaf(n);
+      return;
+    }
+    inner* in = static_cast<inner*>(n);
+    delete in->term;
+    for (std::pair<int, node*> c = child_from(in, 0); c.second != nullptr;
+         c = c.first == 255 ? std::make_pair(-1, static_cast<node*>(nullptr))
+                            : child_from(in, c.first + 1))
+      destroy(c.second);
+    delete_inner(in);
+  }
+
+  static node* copy_node(const node* n) {
+    if (n == nullptr) return nullptr;
+    if (is_leaf(n)) {
+      const leaf* l = as_leaf(n);
+      return leaf_ref(new leaf(l->kv.first, l->kv.second));
+    }
+    const inner* from = static_cast<const inner*>(n);
+    inner* to = retype_empty(from->type);
+    copy_prefix(to, from);
+    try {
+      if (from->term != nullptr)
+        to->term = as_leaf(copy_node(leaf_ref(from->term)));
+      for (std::pair<int, node*> c = child_from(from, 0); c.second != nullptr;
+           c = c.first == 255 ? std::make_pair(-1, static_cast<node*>(nullptr))
+                              : child_from(from, c.first + 1))
+        put_child(to, static_cast<unsigned char>(c.first),
+                  copy_node(c.second));
+    } catch (...) {
+      destroy(to);  // frees the children copied so far
+      throw;
+    }
+    return to;
+  }
+
+  static inner* retype_empty(node_type t) {
+    switch (t) {
+      case kNode4:
+        return new node4;
+      case kNode16:
+        return new node16;
+      case kNode48:
+        return new node48;
+      default:
+        return new node256;
+    }
+  }
+
+  leaf* find_leaf(const Key& key) const {
+    encoded e(key);
+    const unsigned char* k = e.data();
+    const std::size_t len = e.size();
+    node* n = root;
+    std::size_t depth = 0;
+    bool skipped = false;  // prefix bytes that were not compared
+    while (n != nullptr) {
+      if (is_leaf(n)) {
+        leaf* l = as_leaf(n);
+        return equal(encoded(l->kv.first), e) ? l : nullptr;
+      }
+      inner* in = static_cast<inner*>(n);
+      if (len - depth < in->prefix_len ||
+          std::memcmp(in->prefix, k + depth,
+                      std::min<std::size_t>(in->prefix_len, kMaxPrefix)) != 0)
+        return nullptr;
+      skipped |= in->prefix_len > kMaxPrefix;
+      depth += in->prefix_len;
+      if (depth == len) {
+        leaf* l = in->term;
+        if (l != nullptr && skipped && !equal(encoded(l->kv.first), e))
+          return nullptr;
+        return l;
+      }
+      node** child = find_child(in, k[depth++]);
+      n = child != nullptr ? *child : nullptr;
+    }
+    return nullptr;
+  }
+
+  // a node4 for the new leaf l, which is freed if the node cannot be
+  static node4* new_node4(leaf* l) {
+    try {
+      return new node4;
+    } catch (...) {
+      delete l;
+      throw;
+    }
+  }
+
+  // hangs l below nn, whose path ends at depth
+  static void place(inner* nn, leaf* l, const encoded& e, std::size_t depth) {
+    if (e.size() == depth)
+      nn->term = l;
+    else
+      put_child(nn, e.data()[depth], leaf_ref(l));
+  }
+
+  // the leaf of key and whether it was inserted
+  template <class... Args>
+  std::pair<leaf*, bool> emplace_leaf(const Key& key, const encoded& e,
+                                      Args&&... args) {
+    const unsigned char* k = e.data();
+    const std::size_t len = e.size();
+    node** ref = &root;
+    std::size_t depth = 0;
+
+    for (;;) {
+      node* n = *ref;
+      if (n == nullptr) {
+        leaf* l = new leaf(key, std::forward<Args>(args)...);
+        *ref = leaf_ref(l);
+        ++sz;
+        return std::make_pair(l, true);
+      }
+
+      if (is_leaf(n)) {
+        leaf* old = as_leaf(n);
+        encoded oe(old->kv.first);
+        if (equal(oe, e)) return std::make_pair(old, false);
+
+        // the leaf becomes a node branching on the first differing byte
+        std::size_t i = depth;
+        while (i < len && i < oe.size() && k[i] == oe.data()[i]) ++i;
+        leaf* l = new leaf(key, std::forward<Args>(args)...);
+        node4* nn = new_node4(l);
+        set_prefix(nn, k + depth, i - depth);
+        place(nn, old, oe, i);
+        place(nn, l, e, i);
+        *ref = nn;
+        ++sz;
+        return std::make_pair(l, true);
+      }
+
+      inner* in = static_cast<inner*>(n);
+      std::size_t p = match(in, k + depth, len - depth, depth);
+      if (p < in->prefix_len) {
+        // the key leaves the node's prefix: split the prefix there. The
+        // allocations come first, so that a throw leaves in untouched.
+        leaf* l = new leaf(key, std::forward<Args>(args)...);
+        node4* nn = new_node4(l);
+        set_prefix(nn, k + depth, p);
+        unsigned char b = prefix_byte(in, depth, p);
+        cut_prefix(in, depth, p + 1);
+        put_child(nn, b, in);
+        place(nn, l, e, depth + p);
+        *ref = nn;
+        ++sz;
+        return std::make_pair(l, true);
+      }
+
+      depth += p;
+      if (depth == len) {
+        if (in->term != nullptr) return std::make_pair(in->term, false);
+        in->term = new leaf(key, std::forward<Args>(args)...);
+        ++sz;
+        return std::make_pair(in->term, true);
+      }
+
+      node** child = find_child(in, k[depth]);
+      if (child == nullptr) {
+        leaf* l = new leaf(key, std::forward<Args>(args)...);
+        try {
+          add_child(*ref, k[depth], leaf_ref(l));
+        } catch (...) {
+          delete l;
+          throw;
+        }
+        ++sz;
+        return std::make_pair(l, true);
+      }
+      ref = child;
+      ++depth;
+    }
+  }
+
+  template <bool Const>
+  basic_iterator<Const> lower_bound_bytes(const unsigned char* k,
+                                          std::size_t len) const {
+    basic_iterator<Const> it;
+    const node* n = root;
+    std::size_t depth = 0;
+
+    while (n != nullptr) {
+      if (is_leaf(n)) {
+        const leaf* l = as_leaf(n);
+        encoded le(l->kv.first);
+        if (compare(le.data(), le.size(), k, len) >= 0)
+          it.cur = const_cast<leaf*>(l);
+        else
+          it.advance();
+        return it;
+      }
+
+      const inner* in = static_cast<const inner*>(n);
+      std::size_t p = match(in, k + depth, len - depth, depth);
+      if (p < in->prefix_len) {
+        // the whole subtree is either above or below the key
+        if (depth + p == len || prefix_byte(in, depth, p) > k[depth + p])
+          it.leftmost(in);
+        else
+          it.advance();
+        return it;
+      }
+
+      depth += p;
+      if (depth == len) {
+        it.leftmost(in);
+        return it;
+      }
+
+      it.stack.push_back(frame{in, k[depth] + 1});
+      node** child = find_child(const_cast<inner*>(in), k[depth]);
+      if (child == nullptr) {
+        it.advance();
+        return it;
+      }
+      n = *child;
+      ++depth;
+    }
+    return it;
+  }
+
+  node* root;
+  size_type sz;
+};
+
+template <class Key, class T, class Traits>
+typename radix_map<Key, T, Traits>::size_type radix_map<Key, T, Traits>::erase(
+    const Key& key) {
+  encoded e(key);
+  const unsigned char* k = e.data();
+  const std::size_t len = e.size();
+  node** ref = &root;
+  node** parent = nullptr;
+  std::size_t depth = 0;
+
+  while (*ref != nullptr) {
+    node* n = *ref;
+    if (is_leaf(n)) {
+      leaf* l = as_leaf(n);
+      if (!equal(encoded(l->kv.first), e)) return 0;
+      delete l;
+      if (parent == nullptr) {
+        *ref = nullptr;
+      } else {
+        drop_child(static_cast<inner*>(*parent), k[depth - 1]);
+        shrink(*parent);
+      }
+      --sz;
+      return 1;
+    }
+
+    inner* in = static_cast<inner*>(n);
+    if (match(in, k + depth, len - depth, depth) != in->prefix_len) return 0;
+    depth += in->prefix_len;
+    if (depth == len) {
+      if (in->term == nullptr) return 0;
+      delete in->term;
+      in->term = nullptr;
+      shrink(*ref);
+      --sz;
+      return 1;
+    }
+
+    node** child = find_child(in, k[depth]);
+    if (child == nullptr) return 0;
+    parent = ref;
+    ref = child;
+    ++depth;
+  }
+  return 0;
+}
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_RADIX_MAP_H_
@@ -2,6 +2,28 @@
 #define _STL_CONTAINERS_S21_CONTAINERS_PLUS_H_
 
 #include "array.h"
+#include "bitvector.h"
+#include "compact_map.h"
+#include "compact_set.h"
+#include "concurrent_skiplist_map.h"
+#include "concurrent_unordered_map.h"
+#include "frozen_map.h"
+#include "frozen_set.h"
+#include "interval_map.h"
+#include "lru_cache.h"
+#include "mapped_static_map.h"
+#include "mmap_allocator.h"
 #include "multiset.h"
+#include "parallel.h"
+#include "radix_map.h"
+#include "simd.h"
+#include "small_map.h"
+#include "small_set.h"
+#include "small_vector.h"
+#include "static_map.h"
+#include "static_set.h"
+#include "thread_pool.h"
+#include "unordered_map.h"
+#include "unordered_set.h"
 
 #endif  // _STL_CONTAINERS_S21_CONTAINERS_PLUS_H_
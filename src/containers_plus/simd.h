@@ -0,0 +1,554 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_SIMD_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_SIMD_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+
+/* Vectorized find, count, min, max, sum and fill over contiguous s21
+ * containers (vector, small_vector, array: anything with data() and
+ * size()). int32_t and float ranges run SSE2, AVX2 or AVX-512 kernels,
+ * picked once at run time from what the CPU supports; every other element
+ * type, and every CPU without those, takes the scalar loops.
+ *
+ * Integer sums wrap around like unsigned arithmetic. Float sums add in a
+ * different order than a left-to-right loop, so the last bits may differ,
+ * and min/max of a range that holds a NaN are unspecified.
+ *
+ * and_n, or_n, xor_n, not_n and popcount_n work on arrays of 64-bit words,
+ * for bit sets: the bitwise ones at the same levels, popcount with the
+ * POPCNT instruction when the CPU has it.
+ */
+namespace simd {
+
+enum class level { scalar, sse2, avx2, avx512 };
+
+/* Best level the CPU supports */
+inline level detected_level() noexcept {
+#ifdef S21_SIMD_X86
+  static const level best = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return level::avx512;
+    if (__builtin_cpu_supports("avx2")) return level::avx2;
+    if (__builtin_cpu_supports("sse2")) return level::sse2;
+    return level::scalar;
+  }();
+  return best;
+#else
+  return level::scalar;
+#endif
+}
+
+inline std::atomic<level> current_level{detected_level()};
+
+inline level active_level() noexcept {
+  return current_level.load(std::memory_order_relaxed);
+}
+
+/* Caps the level the algorithms use, e.g. to compare kernels or to stay
+ * off AVX-512 frequency licences; levels above detected_level() are
+ * clamped */
+inline void set_level(level l) noexcept {
+  level best = detected_level();
+  current_level.store(l < best ? l : best, std::memory_order_relaxed);
+}
+
+/* Bitwise operation of the word kernels */
+enum class bit_op { and_, or_, xor_, not_ };
+
+/* Set lanes in a compare mask of at most 16 lanes. The kernel targets do
+ * not enable POPCNT, so __builtin_popcount there is a libgcc call that
+ * costs more than the 4-lane compare it counts */
+inline unsigned mask_count(unsigned m) noexcept {
+  static constexpr unsigned char nibble[16] = {0, 1, 1, 2, 1, 2, 2, 3,
+                                               1, 2, 2, 3, 2, 3, 3, 4};
+  unsigned res = 0;
+  for (; m != 0; m >>= 4) res += nibble[m & 15];
+  return res;
+}
+
+namespace scalar {
+
+template <class T>
+T add(T a, T b) noexcept {
+  if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+    typedef std::make_unsigned_t<T> U;
+    return T(U(a) + U(b));
+  } else {
+    return a + b;
+  }
+}
+
+template <class T>
+std::size_t find(const T* p, std::size_t n, const T& v) {
+  std::size_t i = 0;
+  while (i < n && !(p[i] == v)) ++i;
+  return i;
+}
+
+template <class T>
+std::size_t count(const T* p, std::size_t n, const T& v) {
+  std::size_t res = 0;
+  for (std::size_t i = 0; i < n; ++i) res += p[i] == v;
+  return res;
+}
+
+template <class T>
+T min(const T* p, std::size_t n) {
+  T res = p[0];
+  for (std::size_t i = 1; i < n; ++i)
+    if (p[i] < res) res = p[i];
+  return res;
+}
+
+template <class T>
+T max(const T* p, std::size_t n) {
+  T res = p[0];
+  for (std::size_t i = 1; i < n; ++i)
+    if (res < p[i]) res = p[i];
+  return res;
+}
+
+template <class T>
+T sum(const T* p, std::size_t n) {
+  T res = T();
+  for (std::size_t i = 0; i < n; ++i) res = add(res, p[i]);
+  return res;
+}
+
+template <class T>
+void fill(T* p, std::size_t n, const T& v) {
+  for (std::size_t i = 0; i < n; ++i) p[i] = v;
+}
+
+template <bit_op Op>
+void bitwise(std::uint64_t* d, const std::uint64_t* a, const std::uint64_t* b,
+             std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    if constexpr (Op == bit_op::and_) d[i] = a[i] & b[i];
+    if constexpr (Op == bit_op::or_) d[i] = a[i] | b[i];
+    if constexpr (Op == bit_op::xor_) d[i] = a[i] ^ b[i];
+    if constexpr (Op == bit_op::not_) d[i] = ~a[i];
+  }
+}
+
+inline std::size_t popcount(const std::uint64_t* p, std::size_t n) {
+  std::size_t res = 0;
+  for (std::size_t i = 0; i < n; ++i) res += __builtin_popcountll(p[i]);
+  return res;
+}
+
+}  // namespace scalar
+
+#ifdef S21_SIMD_X86
+
+namespace sse2 {
+#define S21_SIMD_TARGET __attribute__((target("sse2")))
+
+template <class T>
+struct ops;
+
+template <>
+struct ops<std::int32_t> {
+  typedef __m128i reg;
+  static constexpr std::size_t width = 4;
+  S21_SIMD_TARGET static reg load(const std::int32_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+  S21_SIMD_TARGET static void store(std::int32_t* p, reg r) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), r);
+  }
+  S21_SIMD_TARGET static reg set1(std::int32_t v) { return _mm_set1_epi32(v); }
+  S21_SIMD_TARGET static unsigned eq(reg a, reg b) {
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+  }
+  S21_SIMD_TARGET static reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+  // SSE2 has no pminsd/pmaxsd, select through the comparison mask
+  S21_SIMD_TARGET static reg min(reg a, reg b) {
+    reg lt = _mm_cmplt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(lt, a), _mm_andnot_si128(lt, b));
+  }
+  S21_SIMD_TARGET static reg max(reg a, reg b) {
+    reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  }
+};
+
+template <>
+struct ops<float> {
+  typedef __m128 reg;
+  static constexpr std::size_t width = 4;
+  S21_SIMD_TARGET static reg load(const float* p) { return _mm_loadu_ps(p); }
+  S21_SIMD_TARGET static void store(float* p, reg r) { _mm_storeu_ps(p, r); }
+  S21_SIMD_TARGET static reg set1(float v) { return _mm_set1_ps(v); }
+  S21_SIMD_TARGET static unsigned eq(reg a, reg b) {
+    return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+  }
+  S21_SIMD_TARGET static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+  S21_SIMD_TARGET static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+  S21_SIMD_TARGET static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+};
+
+struct word_ops {
+  typedef __m128i reg;
+  static constexpr std::size_t width = 2;
+  S21_SIMD_TARGET static reg load(const std::uint64_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+  S21_SIMD_TARGET static void store(std::uint64_t* p, reg r) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), r);
+  }
+  S21_SIMD_TARGET static reg and_(reg a, reg b) { return _mm_and_si128(a, b); }
+  S21_SIMD_TARGET static reg or_(reg a, reg b) { return _mm_or_si128(a, b); }
+  S21_SIMD_TARGET static reg xor_(reg a, reg b) { return _mm_xor_si128(a, b); }
+  S21_SIMD_TARGET static reg ones() { return _mm_set1_epi32(-1); }
+};
+
+#include "simd_kernels.inc"
+#undef S21_SIMD_TARGET
+}  // namespace sse2
+
+namespace avx2 {
+#define S21_SIMD_TARGET __attribute__((target("avx2")))
+
+template <class T>
+struct ops;
+
+template <>
+struct ops<std::int32_t> {
+  typedef __m256i reg;
+  static constexpr std::size_t width = 8;
+  S21_SIMD_TARGET static reg load(const std::int32_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  }
+  S21_SIMD_TARGET static void store(std::int32_t* p, reg r) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), r);
+  }
+  S21_SIMD_TARGET static reg set1(std::int32_t v) {
+    return _mm256_set1_epi32(v);
+  }
+  S21_SIMD_TARGET static unsigned eq(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+  }
+  S21_SIMD_TARGET static reg add(reg a, reg b) {
+    return _mm256_add_epi32(a, b);
+  }
+  S21_SIMD_TARGET static reg min(reg a, reg b) {
+    return _mm256_min_epi32(a, b);
+  }
+  S21_SIMD_TARGET static reg max(reg a, reg b) {
+    return _mm256_max_epi32(a, b);
+  }
+};
+
+template <>
+struct ops<float> {
+  typedef __m256 reg;
+  static constexpr std::size_t width = 8;
+  S21_SIMD_TARGET static reg load(const float* p) { return _mm256_loadu_ps(p); }
+  S21_SIMD_TARGET static void store(float* p, reg r) {
+    _mm256_storeu_ps(p, r);
+  }
+  S21_SIMD_TARGET static reg set1(float v) { return _mm256_set1_ps(v); }
+  S21_SIMD_TARGET static unsigned eq(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+  }
+  S21_SIMD_TARGET static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+  S21_SIMD_TARGET static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+  S21_SIMD_TARGET static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+};
+
+struct word_ops {
+  typedef __m256i reg;
+  static constexpr std::size_t width = 4;
+  S21_SIMD_TARGET static reg load(const std::uint64_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  }
+  S21_SIMD_TARGET static void store(std::uint64_t* p, reg r) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), r);
+  }
+  S21_SIMD_TARGET static reg and_(reg a, reg b) {
+    return _mm256_and_si256(a, b);
+  }
+  S21_SIMD_TARGET static reg or_(reg a, reg b) { return _mm256_or_si256(a, b); }
+  S21_SIMD_TARGET static reg xor_(reg a, reg b) {
+    return _mm256_xor_si256(a, b);
+  }
+  S21_SIMD_TARGET static reg ones() { return _mm256_set1_epi32(-1); }
+};
+
+#include "simd_kernels.inc"
+#undef S21_SIMD_TARGET
+}  // namespace avx2
+
+namespace avx512 {
+#define S21_SIMD_TARGET __attribute__((target("avx512f")))
+
+template <class T>
+struct ops;
+
+// min/max go through the masked forms with a full mask: the plain ones pass
+// _mm512_undefined as the merge source, which GCC 12 flags as uninitialized
+
+template <>
+struct ops<std::int32_t> {
+  typedef __m512i reg;
+  static constexpr std::size_t width = 16;
+  S21_SIMD_TARGET static reg load(const std::int32_t* p) {
+    return _mm512_loadu_si512(p);
+  }
+  S21_SIMD_TARGET static void store(std::int32_t* p, reg r) {
+    _mm512_storeu_si512(p, r);
+  }
+  S21_SIMD_TARGET static reg set1(std::int32_t v) {
+    return _mm512_set1_epi32(v);
+  }
+  S21_SIMD_TARGET static unsigned eq(reg a, reg b) {
+    return _mm512_cmpeq_epi32_mask(a, b);
+  }
+  S21_SIMD_TARGET static reg add(reg a, reg b) {
+    return _mm512_add_epi32(a, b);
+  }
+  S21_SIMD_TARGET static reg min(reg a, reg b) {
+    return _mm512_mask_min_epi32(a, 0xffff, a, b);
+  }
+  S21_SIMD_TARGET static reg max(reg a, reg b) {
+    return _mm512_mask_max_epi32(a, 0xffff, a, b);
+  }
+};
+
+template <>
+struct ops<float> {
+  typedef __m512 reg;
+  static constexpr std::size_t width = 16;
+  S21_SIMD_TARGET static reg load(const float* p) { return _mm512_loadu_ps(p); }
+  S21_SIMD_TARGET static void store(float* p, reg r) {
+    _mm512_storeu_ps(p, r);
+  }
+  S21_SIMD_TARGET static reg set1(float v) { return _mm512_set1_ps(v); }
+  S21_SIMD_TARGET static unsigned eq(reg a, reg b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+  }
+  S21_SIMD_TARGET static reg add(reg a, reg b) { return _mm512_add_ps(a, b); }
+  S21_SIMD_TARGET static reg min(reg a, reg b) {
+    return _mm512_mask_min_ps(a, 0xffff, a, b);
+  }
+  S21_SIMD_TARGET static reg max(reg a, reg b) {
+    return _mm512_mask_max_ps(a, 0xffff, a, b);
+  }
+};
+
+struct word_ops {
+  typedef __m512i reg;
+  static constexpr std::size_t width = 8;
+  S21_SIMD_TARGET static reg load(const std::uint64_t* p) {
+    return _mm512_loadu_si512(p);
+  }
+  S21_SIMD_TARGET static void store(std::uint64_t* p, reg r) {
+    _mm512_storeu_si512(p, r);
+  }
+  S21_SIMD_TARGET static reg and_(reg a, reg b) {
+    return _mm512_and_si512(a, b);
+  }
+  S21_SIMD_TARGET static reg or_(reg a, reg b) { return _mm512_or_si512(a, b); }
+  S21_SIMD_TARGET static reg xor_(reg a, reg b) {
+    return _mm512_xor_si512(a, b);
+  }
+  S21_SIMD_TARGET static reg ones() { return _mm512_set1_epi32(-1); }
+};
+
+#include "simd_kernels.inc"
+#undef S21_SIMD_TARGET
+}  // namespace avx512
+
+/* Kept apart from the levels: POPCNT predates AVX but is not part of SSE2 */
+namespace popcnt {
+
+__attribute__((target("popcnt"))) inline std::size_t popcount(
+    const std::uint64_t* p, std::size_t n) {
+  std::size_t res = 0;
+  for (std::size_t i = 0; i < n; ++i) res += __builtin_popcountll(p[i]);
+  return res;
+}
+
+}  // namespace popcnt
+
+#endif  // S21_SIMD_X86
+
+/* Whether the CPU has the POPCNT instruction */
+inline bool has_popcnt() noexcept {
+#ifdef S21_SIMD_X86
+  static const bool res = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt") != 0;
+  }();
+  return res;
+#else
+  return false;
+#endif
+}
+
+/* True when T has vector kernels */
+template <class T>
+inline constexpr bool has_kernels =
+#ifdef S21_SIMD_X86
+    std::is_same_v<T, std::int32_t> || std::is_same_v<T, float>;
+#else
+    false;
+#endif
+
+#ifdef S21_SIMD_X86
+#define S21_SIMD_DISPATCH(fn, ...)                                      \
+  if constexpr (has_kernels<T>) {                                       \
+    switch (active_level()) {                                           \
+      case level::avx512:                                               \
+        return avx512::fn(__VA_ARGS__);                                 \
+      case level::avx2:                                                 \
+        return avx2::fn(__VA_ARGS__);                                   \
+      case level::sse2:                                                 \
+        return sse2::fn(__VA_ARGS__);                                   \
+      case level::scalar:                                               \
+        break;                                                          \
+    }                                                                   \
+  }                                                                     \
+  return scalar::fn(__VA_ARGS__)
+#else
+#define S21_SIMD_DISPATCH(fn, ...) return scalar::fn(__VA_ARGS__)
+#endif
+
+/* Pointer-and-length versions */
+
+template <class T>
+std::size_t find_n(const T* p, std::size_t n, T v) {
+  S21_SIMD_DISPATCH(find, p, n, v);
+}
+
+template <class T>
+std::size_t count_n(const T* p, std::size_t n, T v) {
+  S21_SIMD_DISPATCH(count, p, n, v);
+}
+
+template <class T>
+T min_n(const T* p, std::size_t n) {
+  if (n == 0) throw std::out_of_range("simd::min of an empty range");
+  S21_SIMD_DISPATCH(min, p, n);
+}
+
+template <class T>
+T max_n(const T* p, std::size_t n) {
+  if (n == 0) throw std::out_of_range("simd::max of an empty range");
+  S21_SIMD_DISPATCH(max, p, n);
+}
+
+template <class T>
+T sum_n(const T* p, std::size_t n) {
+  S21_SIMD_DISPATCH(sum, p, n);
+}
+
+template <class T>
+void fill_n(T* p, std::size_t n, T v) {
+  S21_SIMD_DISPATCH(fill, p, n, v);
+}
+
+/* Word versions: d[i] = a[i] op b[i], d may be a or b */
+
+template <bit_op Op>
+void bitwise_n(std::uint64_t* d, const std::uint64_t* a,
+               const std::uint64_t* b, std::size_t n) {
+#ifdef S21_SIMD_X86
+  switch (active_level()) {
+    case level::avx512:
+      return avx512::bitwise<Op>(d, a, b, n);
+    case level::avx2:
+      return avx2::bitwise<Op>(d, a, b, n);
+    case level::sse2:
+      return sse2::bitwise<Op>(d, a, b, n);
+    case level::scalar:
+      break;
+  }
+#endif
+  scalar::bitwise<Op>(d, a, b, n);
+}
+
+inline void and_n(std::uint64_t* d, const std::uint64_t* a,
+                  const std::uint64_t* b, std::size_t n) {
+  bitwise_n<bit_op::and_>(d, a, b, n);
+}
+
+inline void or_n(std::uint64_t* d, const std::uint64_t* a,
+                 const std::uint64_t* b, std::size_t n) {
+  bitwise_n<bit_op::or_>(d, a, b, n);
+}
+
+inline void xor_n(std::uint64_t* d, const std::uint64_t* a,
+                  const std::uint64_t* b, std::size_t n) {
+  bitwise_n<bit_op::xor_>(d, a, b, n);
+}
+
+/* d[i] = ~a[i] */
+inline void not_n(std::uint64_t* d, const std::uint64_t* a, std::size_t n) {
+  bitwise_n<bit_op::not_>(d, a, a, n);
+}
+
+/* Number of set bits in n words */
+inline std::size_t popcount_n(const std::uint64_t* p, std::size_t n) {
+#ifdef S21_SIMD_X86
+  if (active_level() != level::scalar && has_popcnt())
+    return popcnt::popcount(p, n);
+#endif
+  return scalar::popcount(p, n);
+}
+
+#undef S21_SIMD_DISPATCH
+
+/* Container versions */
+
+template <class C>
+using element_t = std::remove_cv_t<
+    std::remove_pointer_t<decltype(std::declval<C&>().data())>>;
+
+/* Iterator to the first element equal to value, or end() */
+template <class C>
+auto find(C& c, const element_t<C>& value) {
+  return c.begin() + find_n<element_t<C>>(c.data(), c.size(), value);
+}
+
+template <class C>
+std::size_t count(const C& c, const element_t<C>& value) {
+  return count_n<element_t<C>>(c.data(), c.size(), value);
+}
+
+/* Smallest element; throws std::out_of_range on an empty container */
+template <class C>
+element_t<C> min(const C& c) {
+  return min_n<element_t<C>>(c.data(), c.size());
+}
+
+template <class C>
+element_t<C> max(const C& c) {
+  return max_n<element_t<C>>(c.data(), c.size());
+}
+
+template <class C>
+element_t<C> sum(const C& c) {
+  return sum_n<element_t<C>>(c.data(), c.size());
+}
+
+template <class C>
+void fill(C& c, const element_t<C>& value) {
+  fill_n<element_t<C>>(c.data(), c.size(), value);
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_SIMD_H_
@@ -0,0 +1,459 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_MAP_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../containers/rb_tree.h"
+
+namespace s21 {
+
+/* s21::map with a small-size mode. Up to N entries live in two sorted
+ * arrays (keys and values) inside the object, so a small map costs no heap
+ * allocation and a lookup is a scan over N contiguous keys. Inserting the
+ * N+1-th entry spills everything into an RBTree; the map returns to the
+ * inline arrays when erasing brings it down to N / 2 entries, or on clear.
+ *
+ * Iterators dereference to the key like s21::map's, value() gives the
+ * mapped value. A spill or a return to the inline arrays invalidates them.
+ */
+template <class Key, class T, std::size_t N = 8,
+          class Compare = std::less<Key>>
+class small_map {
+  static_assert(N > 0, "small_map needs room for at least one entry");
+
+ public:
+  typedef RBTree<Key, T, Compare, std::allocator<RBNode<Key, T>>> rb_tree;
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+
+  template <bool Const>
+  class basic_iterator;
+  typedef basic_iterator<false> iterator;
+  typedef basic_iterator<true> const_iterator;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_map() : sz{0}, spilled{false}, tree{}, comp{} {}
+
+  small_map(const small_map& other)
+      : sz{0}, spilled{other.spilled}, tree{other.tree}, comp{other.comp} {
+    if (!spilled) {
+      try {
+        for (; sz < other.sz; ++sz) {
+          ::new ((void*)(keys() + sz)) Key(other.keys()[sz]);
+          try {
+            ::new ((void*)(values() + sz)) T(other.values()[sz]);
+          } catch (...) {
+            keys()[sz].~Key();
+            throw;
+          }
+        }
+      } catch (...) {
+        destroy_inline();  // the sz entries built so far
+        throw;
+      }
+    }
+    sz = other.sz;
+  }
+
+  small_map(small_map&& other) noexcept(kNothrowMove)
+      : sz{0}, spilled{false}, tree{}, comp{other.comp} {
+    take(other);
+  }
+
+  small_map(std::initializer_list<value_type> init) : small_map() {
+    for (const value_type& v : init) insert(v);
+  }
+
+  small_map& operator=(const small_map& other) {
+    if (this != &other) {
+      small_map tmp{other};
+      clear();
+      take(tmp);
+    }
+    return *this;
+  }
+
+  small_map& operator=(small_map&& other) noexcept(kNothrowMove) {
+    if (this != &other) {
+      clear();
+      take(other);
+    }
+    return *this;
+  }
+
+  small_map& operator=(std::initializer_list<value_type> init) {
+    small_map tmp{init};
+    return *this = std::move(tmp);
+  }
+
+  ~small_map() { destroy_inline(); }
+
+  T& at(const Key& key) {
+    iterator it = find(key);
+    if (it == end()) throw std::out_of_range("small_map::at");
+    return it.value();
+  }
+
+  const T& at(const Key& key) const {
+    const_iterator it = find(key);
+    if (it == end()) throw std::out_of_range("small_map::at");
+    return it.value();
+  }
+
+  T& operator[](const Key& key) {
+    return insert(value_type(key, T())).first.value();
+  }
+
+  iterator begin() noexcept { return make_iterator(tree.begin(), 0); }
+  const_iterator begin() const noexcept {
+    return const_cast<small_map*>(this)->begin();
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return make_iterator(tree.end(), sz); }
+  const_iterator end() const noexcept {
+    return const_cast<small_map*>(this)->end();
+  }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return sz == 0; }
+  size_type size() const noexcept { return sz; }
+
+  /* True while the entries live in the inline arrays */
+  bool is_inline() const noexcept { return !spilled; }
+
+  void clear() noexcept {
+    destroy_inline();
+    tree.clear();
+    sz = 0;
+    spilled = false;
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    if (spilled) {
+      std::pair<typename rb_tree::iterator, bool> res = tree.insert(value);
+      sz += res.second;
+      return std::make_pair(make_iterator(res.first, 0), res.second);
+    }
+    size_type pos = lower_index(value.first);
+    if (pos < sz && !comp(value.first, keys()[pos]))
+      return std::make_pair(make_iterator(tree.end(), pos), false);
+    if (sz == N) {
+      spill();
+      return insert(value);
+    }
+    insert_inline(pos, value.first, value.second);
+    return std::make_pair(make_iterator(tree.end(), pos), true);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    std::pair<iterator, bool> res = insert(value_type(key, obj));
+    if (!res.second) {
+      if (spilled)
+        tree.insert_or_assign(key, obj);
+      else
+        res.first.value() = obj;
+    }
+    return res;
+  }
+
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> emplace(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> res;
+    res.reserve(sizeof...(args));
+    for (auto value : {std::forward<Args>(args)...})
+      res.push_back(insert(value));
+    return res;
+  }
+
+  size_type erase(const Key& key) {
+    if (spilled) {
+      if (tree.erase(key) == 0) return 0;
+      if (--sz <= N / 2) {
+        try {
+          unspill();
+        } catch (...) {
+          // the key is gone either way, the map just stays in the tree
+        }
+      }
+      return 1;
+    }
+    size_type pos = lower_index(key);
+    if (pos == sz || comp(key, keys()[pos])) return 0;
+    erase_inline(pos);
+    return 1;
+  }
+
+  void swap(small_map& other) noexcept(kNothrowMove) {
+    small_map tmp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  iterator find(const Key& key) {
+    if (spilled) return make_iterator(tree.find(key), 0);
+    size_type pos = lower_index(key);
+    if (pos == sz || comp(key, keys()[pos])) return end();
+    return make_iterator(tree.end(), pos);
+  }
+
+  const_iterator find(const Key& key) const {
+    return const_cast<small_map*>(this)->find(key);
+  }
+
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  iterator lower_bound(const Key& key) {
+    if (spilled) return make_iterator(tree.lower_bound(key), 0);
+    return make_iterator(tree.end(), lower_index(key));
+  }
+
+  const_iterator lower_bound(const Key& key) const {
+    return const_cast<small_map*>(this)->lower_bound(key);
+  }
+
+  iterator upper_bound(const Key& key) {
+    if (spilled) return make_iterator(tree.upper_bound(key), 0);
+    size_type pos = 0;
+    for (size_type i = 0; i < sz; ++i) pos += !comp(key, keys()[i]);
+    return make_iterator(tree.end(), pos);
+  }
+
+  const_iterator upper_bound(const Key& key) const {
+    return const_cast<small_map*>(this)->upper_bound(key);
+  }
+
+  template <bool Const>
+  class basic_iterator {
+    typedef std::conditional_t<Const, const small_map, small_map> owner_type;
+    typedef std::conditional_t<Const, const T, T> value_ref_type;
+
+   public:
+    basic_iterator() : owner{nullptr}, idx{0}, it{} {}
+
+    template <bool C = Const, class = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false>& other)
+        : owner{other.owner}, idx{other.idx}, it{other.it} {}
+
+    bool operator==(const basic_iterator& other) const {
+      return idx == other.idx && it == other.it;
+    }
+    bool operator!=(const basic_iterator& other) const {
+      return !(*this == other);
+    }
+
+    basic_iterator& operator++() {
+      if (owner->spilled)
+        ++it;
+      else
+        ++idx;
+      return *this;
+    }
+
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    basic_iterator& operator--() {
+      if (!owner->spilled)
+        --idx;
+      else if (it == typename rb_tree::iterator())
+        it = typename rb_tree::iterator(owner->tree.get_root()->max());
+      else
+        --it;
+      return *this;
+    }
+
+    basic_iterator operator--(int) {
+      basic_iterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    const Key& operator*() const { return key(); }
+
+    const Key& key() const {
+      return owner->spilled ? *it : owner->keys()[idx];
+    }
+
+    value_ref_type& value() const {
+      return owner->spilled ? it.get_ptr()->value : owner->values()[idx];
+    }
+
+   private:
+    friend class small_map;
+    template <bool>
+    friend class basic_iterator;
+
+    basic_iterator(owner_type* o, size_type i, typename rb_tree::iterator t)
+        : owner{o}, idx{i}, it{t} {}
+
+    owner_type* owner;
+    size_type idx;
+    typename rb_tree::iterator it;
+  };
+
+ private:
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_constructible<Key>::value &&
+      std::is_nothrow_move_constructible<T>::value;
+
+  Key* keys() noexcept {
+    return std::launder(reinterpret_cast<Key*>(key_buf));
+  }
+  const Key* keys() const noexcept {
+    return std::launder(reinterpret_cast<const Key*>(key_buf));
+  }
+  T* values() noexcept { return std::launder(reinterpret_cast<T*>(value_buf)); }
+  const T* values() const noexcept {
+    return std::launder(reinterpret_cast<const T*>(value_buf));
+  }
+
+  iterator make_iterator(typename rb_tree::iterator t, size_type i) noexcept {
+    return spilled ? iterator(this, 0, t) : iterator(this, i, tree.end());
+  }
+
+  /* Number of keys less than key. The loop has no data-dependent branch,
+   * so for arithmetic keys the compiler turns it into a SIMD compare. */
+  size_type lower_index(const Key& key) const {
+    size_type pos = 0;
+    for (size_type i = 0; i < sz; ++i) pos += comp(keys()[i], key);
+    return pos;
+  }
+
+  void insert_inline(size_type pos, const Key& key, const T& value) {
+    Key* k = keys();
+    T* v = values();
+    if (pos == sz) {
+      ::new ((void*)(k + sz)) Key(key);
+      try {
+        ::new ((void*)(v + sz)) T(value);
+      } catch (...) {
+        k[sz].~Key();
+        throw;
+      }
+    } else {
+      // the copies are made before anything shifts, so a throwing copy
+      // leaves the entries as they were
+      Key new_key(key);
+      T new_value(value);
+      ::new ((void*)(k + sz)) Key(std::move(k[sz - 1]));
+      try {
+        ::new ((void*)(v + sz)) T(std::move(v[sz - 1]));
+      } catch (...) {
+        k[sz].~Key();
+        throw;
+      }
+      ++sz;
+      std::move_backward(k + pos, k + sz - 2, k + sz - 1);
+      std::move_backward(v + pos, v + sz - 2, v + sz - 1);
+      k[pos] = std::move(new_key);
+      v[pos] = std::move(new_value);
+      return;
+    }
+    ++sz;
+  }
+
+  void erase_inline(size_type pos) {
+    std::move(keys() + pos + 1, keys() + sz, keys() + pos);
+    std::move(values() + pos + 1, values() + sz, values() + pos);
+    --sz;
+    keys()[sz].~Key();
+    values()[sz].~T();
+  }
+
+  void destroy_inline() noexcept {
+    if (spilled) return;
+    for (size_type i = 0; i < sz; ++i) {
+      keys()[i].~Key();
+      values()[i].~T();
+    }
+  }
+
+  /* Moves the inline entries into the tree, the map stays intact on throw */
+  void spill() {
+    try {
+      for (size_type i = 0; i < sz; ++i)
+        tree.insert(value_type(keys()[i], values()[i]));
+    } catch (...) {
+      tree.clear();
+      throw;
+    }
+    destroy_inline();
+    spilled = true;
+  }
+
+  /* Moves at most N / 2 entries from the tree back into the arrays. Copies
+   * both key and value unless both move without throwing, so that the tree
+   * stays intact on failure. */
+  void unspill() {
+    size_type n = 0;
+    try {
+      for (typename rb_tree::iterator it = tree.begin(); it != tree.end();
+           ++it, ++n) {
+        ::new ((void*)(keys() + n)) Key(take_from_tree(*it));
+        try {
+          ::new ((void*)(values() + n)) T(take_from_tree(it.get_ptr()->value));
+        } catch (...) {
+          keys()[n].~Key();
+          throw;
+        }
+      }
+    } catch (...) {
+      for (size_type i = 0; i < n; ++i) {
+        keys()[i].~Key();
+        values()[i].~T();
+      }
+      throw;
+    }
+    tree.clear();
+    spilled = false;
+  }
+
+  /* Tree entry as an rvalue when a whole entry moves without throwing */
+  template <class U>
+  static std::conditional_t<kNothrowMove, U&&, const U&> take_from_tree(
+      U& x) noexcept {
+    return static_cast<std::conditional_t<kNothrowMove, U&&, const U&>>(x);
+  }
+
+  /* Steals other's entries into an empty *this, other is left empty */
+  void take(small_map& other) noexcept(kNothrowMove) {
+    comp = other.comp;
+    if (other.spilled) {
+      tree = std::move(other.tree);
+      spilled = true;
+      sz = other.sz;
+    } else {
+      for (; sz < other.sz; ++sz) {
+        ::new ((void*)(keys() + sz)) Key(std::move(other.keys()[sz]));
+        ::new ((void*)(values() + sz)) T(std::move(other.values()[sz]));
+      }
+    }
+    other.clear();
+  }
+
+  size_type sz;
+  bool spilled;
+  alignas(Key) unsigned char key_buf[N * sizeof(Key)];
+  alignas(T) unsigned char value_buf[N * sizeof(T)];
+  rb_tree tree;
+  Compare comp;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_MAP_H_
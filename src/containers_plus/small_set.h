@@ -0,0 +1,83 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_SET_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_SET_H_
+
+#include "small_map.h"
+
+namespace s21 {
+
+/* s21::set with a small-size mode, see small_map.h */
+template <class Key, std::size_t N = 8, class Compare = std::less<Key>>
+class small_set {
+ public:
+  typedef char T;
+  typedef small_map<Key, T, N, Compare> map_type;
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename map_type::const_iterator iterator;
+  typedef typename map_type::const_iterator const_iterator;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_set() : m{} {}
+
+  small_set(std::initializer_list<value_type> init) : m{} {
+    for (const value_type& v : init) insert(v);
+  }
+
+  small_set& operator=(std::initializer_list<value_type> init) {
+    small_set tmp{init};
+    return *this = std::move(tmp);
+  }
+
+  const_iterator begin() const noexcept { return m.begin(); }
+  const_iterator cbegin() const noexcept { return m.cbegin(); }
+  const_iterator end() const noexcept { return m.end(); }
+  const_iterator cend() const noexcept { return m.cend(); }
+
+  bool empty() const noexcept { return m.empty(); }
+  size_type size() const noexcept { return m.size(); }
+  bool is_inline() const noexcept { return m.is_inline(); }
+
+  void clear() noexcept { m.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return m.insert(typename map_type::value_type(value, T()));
+  }
+
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> emplace(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> res;
+    res.reserve(sizeof...(args));
+    for (auto value : {std::forward<Args>(args)...})
+      res.push_back(insert(value));
+    return res;
+  }
+
+  size_type erase(const Key& key) { return m.erase(key); }
+
+  void swap(small_set& other) noexcept(noexcept(m.swap(other.m))) {
+    m.swap(other.m);
+  }
+
+  const_iterator find(const Key& key) const { return m.find(key); }
+
+  bool contains(const Key& key) const { return m.contains(key); }
+
+  const_iterator lower_bound(const Key& key) const {
+    return m.lower_bound(key);
+  }
+  const_iterator upper_bound(const Key& key) const {
+    return m.upper_bound(key);
+  }
+
+ private:
+  map_type m;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_SET_H_
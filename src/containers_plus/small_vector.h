@@ -0,0 +1,447 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_VECTOR_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* s21::vector with room for N elements inside the object. Up to N elements
+ * need no allocation; growing past N moves them to the heap, and
+ * shrink_to_fit brings a vector that fits again back inline. A heap-backed
+ * small_vector moves by stealing the buffer like s21::vector, an inline one
+ * has to move its elements. Iterators are s21::vector's, and relocation,
+ * growth (Growth, see vector_growth.h) and the insert paths are shared
+ * with it through vector_ops.
+ */
+template <class T, std::size_t N = 16, class A = std::allocator<T>,
+          class Growth = growth_double>
+class small_vector {
+  static_assert(N > 0, "small_vector needs room for at least one element");
+
+  template <class It>
+  using require_input_iterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::input_iterator_tag>>;
+
+  template <class It>
+  static constexpr bool is_forward_iterator = std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::forward_iterator_tag>;
+
+ public:
+  typedef A allocator_type;
+  typedef T value_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::size_t size_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef Growth growth_policy;
+  typedef typename vector<T, A>::iterator iterator;
+  typedef typename vector<T, A>::const_iterator const_iterator;
+  typedef typename vector<T, A>::reverse_iterator reverse_iterator;
+  typedef typename vector<T, A>::const_reverse_iterator const_reverse_iterator;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_vector() noexcept(noexcept(A())) : alloc{} { reset(); }
+
+  explicit small_vector(size_type count, const T& value = T(),
+                        const A& a = A())
+      : alloc{a} {
+    reset();
+    insert(end(), count, value);
+  }
+
+  template <class InputIt, class = require_input_iterator<InputIt>>
+  small_vector(InputIt first, InputIt last, const A& a = A()) : alloc{a} {
+    reset();
+    insert(end(), first, last);
+  }
+
+  small_vector(std::initializer_list<T> init, const A& a = A())
+      : small_vector(init.begin(), init.end(), a) {}
+
+  small_vector(const small_vector& other)
+      : small_vector(other.begin(), other.end(), other.alloc) {}
+
+  small_vector(small_vector&& other) noexcept(kNothrowRelocate)
+      : alloc{other.alloc} {
+    reset();
+    take(other);
+  }
+
+  ~small_vector() { release(); }
+
+  small_vector& operator=(const small_vector& other) {
+    if (this != &other) assign(other.begin(), other.end());
+    return *this;
+  }
+
+  small_vector& operator=(small_vector&& other) noexcept(kNothrowRelocate) {
+    if (this != &other) {
+      release();
+      reset();
+      alloc = other.alloc;
+      take(other);
+    }
+    return *this;
+  }
+
+  small_vector& operator=(std::initializer_list<T> ilist) {
+    assign(ilist.begin(), ilist.end());
+    return *this;
+  }
+
+  void assign(size_type count, const T& value) {
+    small_vector tmp(count, value, alloc);
+    *this = std::move(tmp);
+  }
+
+  template <class InputIt, class = require_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void assign(std::initializer_list<T> ilist) { *this = ilist; }
+
+  allocator_type get_allocator() const noexcept { return alloc; }
+
+  reference at(size_type pos) {
+    if (!(pos < size()))
+      throw std::out_of_range("argument is out of vector range");
+    return elem[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (!(pos < size()))
+      throw std::out_of_range("argument is out of vector range");
+    return elem[pos];
+  }
+
+  reference operator[](size_type pos) { return elem[pos]; }
+  const_reference operator[](size_type pos) const { return elem[pos]; }
+
+  reference front() { return *elem; }
+  const_reference front() const { return *elem; }
+  reference back() { return *(space - 1); }
+  const_reference back() const { return *(space - 1); }
+
+  pointer data() noexcept { return elem; }
+  const_pointer data() const noexcept { return elem; }
+
+  iterator begin() noexcept { return iterator(elem); }
+  const_iterator begin() const noexcept { return const_iterator(elem); }
+  const_iterator cbegin() const noexcept { return const_iterator(elem); }
+  iterator end() noexcept { return iterator(space); }
+  const_iterator end() const noexcept { return const_iterator(space); }
+  const_iterator cend() const noexcept { return const_iterator(space); }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator(space - 1); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(space - 1);
+  }
+  const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+  reverse_iterator rend() noexcept { return reverse_iterator(elem - 1); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(elem - 1);
+  }
+  const_reverse_iterator crend() const noexcept { return rend(); }
+
+  bool empty() const noexcept { return space == elem; }
+  size_type size() const noexcept { return space - elem; }
+  size_type max_size() const noexcept {
+    return std::allocator_traits<A>::max_size(alloc);
+  }
+  size_type capacity() const noexcept { return last - elem; }
+
+  /* True while the elements live in the inline buffer */
+  bool is_inline() const noexcept { return elem == inline_data(); }
+
+  void reserve(size_type newalloc) {
+    if (newalloc <= capacity()) return;
+    if (newalloc > max_size()) throw std::length_error("vector too long");
+    if constexpr (ops::kUseRealloc) {
+      if (reallocatable()) {
+        reallocate(newalloc);
+        return;
+      }
+    }
+    move_to(allocate(newalloc), newalloc);
+  }
+
+  /* Returns to the inline buffer when the elements fit in it */
+  void shrink_to_fit() {
+    if (is_inline() || space == last) return;
+    if (size() <= N)
+      move_to(inline_data(), N);
+    else if constexpr (ops::kUseRealloc)
+      reallocate(size());
+    else
+      move_to(allocate(size()), size());
+  }
+
+  void clear() noexcept {
+    destroy(elem, space);
+    space = elem;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return insert(pos, 1, value);
+  }
+
+  iterator insert(iterator pos, T&& value) {
+    return insert_gap(check_position(pos), 1, [&](pointer gap) {
+      ::new ((void*)gap) T(std::move(value));
+    });
+  }
+
+  iterator insert(iterator pos, size_type count, const_reference value) {
+    size_type index = check_position(pos);
+    if (std::addressof(value) >= elem && std::addressof(value) < space) {
+      T copy(value);
+      return insert(pos, count, copy);
+    }
+    return insert_gap(index, count, [&](pointer gap) {
+      std::uninitialized_fill_n(gap, count, value);
+    });
+  }
+
+  template <class InputIt, class = require_input_iterator<InputIt>>
+  iterator insert(iterator pos, InputIt first, InputIt last) {
+    size_type index = check_position(pos);
+    if constexpr (is_forward_iterator<InputIt>) {
+      size_type count = std::distance(first, last);
+      return insert_gap(index, count, [&](pointer gap) {
+        std::uninitialized_copy(first, last, gap);
+      });
+    } else {
+      size_type old_size = size();
+      for (; first != last; ++first) emplace_back(*first);
+      std::rotate(elem + index, elem + old_size, space);
+      return begin() + index;
+    }
+  }
+
+  template <class... Args>
+  iterator emplace(iterator pos, Args&&... args) {
+    size_type index = check_position(pos);
+    if (index == size()) {
+      emplace_back(std::forward<Args>(args)...);
+      return begin() + index;
+    }
+    T value(std::forward<Args>(args)...);
+    return insert(pos, std::move(value));
+  }
+
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    if (space == last) return realloc_append(std::forward<Args>(args)...);
+    ::new ((void*)space) T(std::forward<Args>(args)...);
+    return *space++;
+  }
+
+  void push_back(const T& value) { emplace_back(value); }
+
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  void pop_back() {
+    if (space != elem) std::allocator_traits<A>::destroy(alloc, --space);
+  }
+
+  iterator erase(iterator pos) {
+    if (!(pos < end() && pos >= begin()))
+      throw std::out_of_range("pos is out of range in erase");
+    return erase(pos, pos + 1);
+  }
+
+  iterator erase(iterator first, iterator last) {
+    if (first < begin() || first > last || last > end())
+      throw std::out_of_range("out_of_range in erase()");
+    pointer f = elem + (first - begin());
+    pointer l = elem + (last - begin());
+    pointer new_end = std::move(l, space, f);
+    destroy(new_end, space);
+    space = new_end;
+    return iterator(f);
+  }
+
+  void resize(size_type newsize) {
+    if (newsize <= size()) {
+      erase(begin() + newsize, end());
+    } else {
+      if (newsize > capacity()) reserve(recommend(newsize));
+      for (size_type n = size(); n < newsize; ++n) emplace_back();
+    }
+  }
+
+  void resize(size_type newsize, const_reference value) {
+    if (newsize <= size())
+      erase(begin() + newsize, end());
+    else
+      insert(end(), newsize - size(), value);
+  }
+
+  /* See s21::vector::resize_uninitialized */
+  void resize_uninitialized(size_type newsize) {
+    static_assert(std::is_trivially_default_constructible_v<T> &&
+                      std::is_trivially_destructible_v<T>,
+                  "resize_uninitialized needs a trivial T");
+    if (newsize > capacity()) reserve(recommend(newsize));
+    space = elem + newsize;
+  }
+
+  pointer append_uninitialized(size_type n) {
+    const size_type sz = size();
+    if (n > max_size() - sz) throw std::length_error("vector too long");
+    if (sz + n > capacity()) reserve(recommend(sz + n));
+    space = elem + sz + n;
+    return elem + sz;
+  }
+
+  void swap(small_vector& other) noexcept(kNothrowRelocate) {
+    small_vector tmp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  typedef vector_ops<T, A> ops;
+  friend ops;
+
+  static constexpr bool kNothrowRelocate = ops::kNothrowRelocate;
+
+  pointer inline_data() noexcept {
+    return std::launder(reinterpret_cast<pointer>(buf));
+  }
+  const_pointer inline_data() const noexcept {
+    return std::launder(reinterpret_cast<const_pointer>(buf));
+  }
+
+  void reset() noexcept {
+    elem = space = inline_data();
+    last = elem + N;
+  }
+
+  void destroy(pointer first, pointer last_) noexcept {
+    ops::destroy(alloc, first, last_);
+  }
+
+  /* Destroys the elements and frees a heap buffer */
+  void release() noexcept {
+    destroy(elem, space);
+    if (!is_inline()) deallocate(elem, capacity());
+  }
+
+  size_type check_position(iterator pos) {
+    if (pos < begin() || pos > end())
+      throw std::out_of_range("position is out of range");
+    return pos - begin();
+  }
+
+  /* Switches to storage (inline or freshly allocated) of capacity cap that
+   * is known to hold all elements */
+  void move_to(pointer storage, size_type cap) {
+    pointer out;
+    try {
+      out = ops::transfer(alloc, elem, space, storage);
+    } catch (...) {
+      if (storage != inline_data()) deallocate(storage, cap);
+      throw;
+    }
+    ops::destroy_relocated(alloc, elem, space);
+    if (storage == inline_data()) {
+      if (!is_inline()) deallocate(elem, capacity());
+      elem = storage;
+      space = out;
+      last = storage + cap;
+    } else {
+      adopt(storage, out, cap);
+    }
+  }
+
+  /* Steals a heap buffer, or relocates inline elements into *this, which
+   * must be empty and inline; other is left empty and inline */
+  void take(small_vector& other) noexcept(kNothrowRelocate) {
+    if (other.is_inline()) {
+      space = ops::transfer(alloc, other.elem, other.space, elem);
+      ops::destroy_relocated(other.alloc, other.elem, other.space);
+    } else {
+      elem = other.elem;
+      space = other.space;
+      last = other.last;
+    }
+    other.reset();
+  }
+
+  /* Storage hooks of vector_ops. Heap blocks are vector_base's, so that
+   * trivially copyable elements grow with realloc once they left the
+   * inline buffer. */
+  size_type recommend(size_type needed) const {
+    if (needed > max_size()) throw std::length_error("vector too long");
+    return std::min<size_type>(
+        std::max<size_type>(Growth::next(capacity(), needed, sizeof(T)), 1),
+        max_size());
+  }
+  pointer allocate(size_type n) {
+    return vector_base<T, A>::allocate(alloc, n);
+  }
+  void deallocate(pointer p, size_type n) noexcept {
+    vector_base<T, A>::deallocate(alloc, p, n);
+  }
+  void adopt(pointer b, pointer space_, size_type n) noexcept {
+    if (!is_inline()) deallocate(elem, capacity());
+    elem = b;
+    space = space_;
+    last = b + n;
+  }
+  bool reallocatable() const noexcept { return !is_inline(); }
+  void reallocate(size_type n) {
+    const size_type sz = size();
+    elem = vector_base<T, A>::reallocate(alloc, elem, capacity(), n);
+    space = elem + sz;
+    last = elem + n;
+  }
+  void set_size(size_type n) noexcept { space = elem + n; }
+  A& alloc_ref() noexcept { return alloc; }
+
+  template <class... Args>
+  reference realloc_append(Args&&... args) {
+    return ops::realloc_append(*this, std::forward<Args>(args)...);
+  }
+
+  template <class Fill>
+  iterator insert_gap(size_type index, size_type count, Fill fill) {
+    ops::insert_gap(*this, index, count, fill);
+    return begin() + index;
+  }
+
+  pointer elem;
+  pointer space;
+  pointer last;
+  A alloc;
+  alignas(T) unsigned char buf[N * sizeof(T)];
+};
+
+template <class T, std::size_t N, class A, class G>
+bool operator==(const small_vector<T, N, A, G>& a,
+                const small_vector<T, N, A, G>& b) {
+  return a.size() == b.size() && std::equal(a.data(), a.data() + a.size(),
+                                            b.data());
+}
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_SMALL_VECTOR_H_
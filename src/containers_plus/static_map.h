@@ -0,0 +1,162 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_STATIC_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_STATIC_MAP_H_
+
+#include <utility>
+
+#include "static_set.h"
+
+namespace s21 {
+
+/* Map of N entries sorted at compile time, for lookup tables that never
+ * change (opcode -> handler, enum -> name):
+ *
+ *   constexpr auto names = s21::make_static_map<int, const char*>(
+ *       {{2, "two"}, {1, "one"}});
+ *   static_assert(names.at(1)[0] == 'o');
+ */
+template <class Key, class T, std::size_t N, class Compare = std::less<Key>>
+class static_map {
+  static_assert(N > 0, "static_map must hold at least one entry");
+
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+
+  class const_iterator;
+  typedef const_iterator iterator;
+
+  constexpr explicit static_map(const std::pair<Key, T> (&items)[N])
+      : keys{}, values{} {
+    for (size_type i = 0; i < N; ++i) {
+      keys[i] = items[i].first;
+      values[i] = items[i].second;
+    }
+
+    Compare comp{};
+    static_heap_sort(
+        N, [&](size_type i, size_type j) { return comp(keys[i], keys[j]); },
+        [&](size_type i, size_type j) {
+          Key k = keys[i];
+          keys[i] = keys[j];
+          keys[j] = k;
+          T v = values[i];
+          values[i] = values[j];
+          values[j] = v;
+        });
+
+    for (size_type i = 1; i < N; ++i)
+      if (!comp(keys[i - 1], keys[i]))
+        throw std::invalid_argument("static_map: duplicate key");
+  }
+
+  constexpr const T& at(const Key& key) const {
+    size_type i = lower_index(key);
+    if (i == N || Compare{}(key, keys[i]))
+      throw std::out_of_range("static_map::at");
+    return values[i];
+  }
+
+  constexpr const_iterator begin() const noexcept {
+    return const_iterator(this, 0);
+  }
+  constexpr const_iterator end() const noexcept {
+    return const_iterator(this, N);
+  }
+
+  constexpr bool empty() const noexcept { return false; }
+  constexpr size_type size() const noexcept { return N; }
+
+  constexpr const_iterator find(const Key& key) const {
+    size_type i = lower_index(key);
+    return const_iterator(this, i != N && !Compare{}(key, keys[i]) ? i : N);
+  }
+
+  constexpr bool contains(const Key& key) const { return find(key) != end(); }
+
+  constexpr size_type count(const Key& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  constexpr const_iterator lower_bound(const Key& key) const {
+    return const_iterator(this, lower_index(key));
+  }
+
+  class const_iterator {
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef Key value_type;
+    typedef const Key& reference;
+    typedef const Key* pointer;
+    typedef std::bidirectional_iterator_tag iterator_category;
+
+    constexpr const_iterator() : m{nullptr}, i{0} {}
+    constexpr const_iterator(const static_map* owner, size_type pos)
+        : m{owner}, i{pos} {}
+
+    constexpr bool operator==(const const_iterator& other) const {
+      return i == other.i;
+    }
+    constexpr bool operator!=(const const_iterator& other) const {
+      return i != other.i;
+    }
+
+    constexpr const_iterator& operator++() {
+      ++i;
+      return *this;
+    }
+
+    constexpr const_iterator operator++(int) {
+      const_iterator tmp = *this;
+      ++i;
+      return tmp;
+    }
+
+    constexpr const_iterator& operator--() {
+      --i;
+      return *this;
+    }
+
+    constexpr const_iterator operator--(int) {
+      const_iterator tmp = *this;
+      --i;
+      return tmp;
+    }
+
+    constexpr const Key& operator*() const { return m->keys[i]; }
+
+    constexpr const Key& key() const { return m->keys[i]; }
+    constexpr const T& value() const { return m->values[i]; }
+
+   private:
+    const static_map* m;
+    size_type i;
+  };
+
+ private:
+  constexpr size_type lower_index(const Key& key) const {
+    size_type first = 0, last = N;
+    while (first < last) {
+      size_type mid = first + (last - first) / 2;
+      if (Compare{}(keys[mid], key))
+        first = mid + 1;
+      else
+        last = mid;
+    }
+    return first;
+  }
+
+  array<Key, N> keys;
+  array<T, N> values;
+};
+
+template <class Key, class T, std::size_t N>
+constexpr static_map<Key, T, N> make_static_map(
+    const std::pair<Key, T> (&items)[N]) {
+  return static_map<Key, T, N>(items);
+}
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_STATIC_MAP_H_
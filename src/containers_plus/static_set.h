@@ -0,0 +1,115 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_STATIC_SET_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_STATIC_SET_H_
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+#include "array.h"
+
+namespace s21 {
+
+/* constexpr heap sort over n positions; swap(i, j) exchanges two positions
+ * so that parallel arrays can be sorted together. std::sort and std::swap are
+ * not constexpr before C++20, and insertion sort would run into the compiler's
+ * constexpr loop limits for a few thousand elements.
+ */
+template <class Less, class Swap>
+constexpr void static_heap_sort(std::size_t n, Less less, Swap swap) {
+  auto sift_down = [&](std::size_t root, std::size_t end) {
+    while (2 * root + 1 < end) {
+      std::size_t child = 2 * root + 1;
+      if (child + 1 < end && less(child, child + 1)) ++child;
+      if (!less(root, child)) return;
+      swap(root, child);
+      root = child;
+    }
+  };
+
+  for (std::size_t i = n / 2; i > 0; --i) sift_down(i - 1, n);
+  for (std::size_t end = n; end > 1; --end) {
+    swap(0, end - 1);
+    sift_down(0, end - 1);
+  }
+}
+
+/* Set of N keys sorted at compile time, with no allocation and no static
+ * initialization when declared constexpr:
+ *
+ *   constexpr auto primes = s21::make_static_set<int>({7, 2, 5, 3});
+ *   static_assert(primes.contains(5));
+ */
+template <class Key, std::size_t N, class Compare = std::less<Key>>
+class static_set {
+  static_assert(N > 0, "static_set must hold at least one key");
+
+ public:
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef std::size_t size_type;
+  typedef Compare key_compare;
+  typedef const Key* const_iterator;
+  typedef const_iterator iterator;
+
+  constexpr explicit static_set(const Key (&items)[N]) : keys{} {
+    for (size_type i = 0; i < N; ++i) keys[i] = items[i];
+
+    Compare comp{};
+    static_heap_sort(
+        N, [&](size_type i, size_type j) { return comp(keys[i], keys[j]); },
+        [&](size_type i, size_type j) {
+          Key tmp = keys[i];
+          keys[i] = keys[j];
+          keys[j] = tmp;
+        });
+
+    for (size_type i = 1; i < N; ++i)
+      if (!comp(keys[i - 1], keys[i]))
+        throw std::invalid_argument("static_set: duplicate key");
+  }
+
+  constexpr const_iterator begin() const noexcept { return keys.data(); }
+  constexpr const_iterator end() const noexcept { return keys.data() + N; }
+
+  constexpr bool empty() const noexcept { return false; }
+  constexpr size_type size() const noexcept { return N; }
+
+  constexpr const_iterator find(const Key& key) const {
+    size_type i = lower_index(key);
+    return i != N && !Compare{}(key, keys[i]) ? begin() + i : end();
+  }
+
+  constexpr bool contains(const Key& key) const { return find(key) != end(); }
+
+  constexpr size_type count(const Key& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  constexpr const_iterator lower_bound(const Key& key) const {
+    return begin() + lower_index(key);
+  }
+
+ private:
+  constexpr size_type lower_index(const Key& key) const {
+    size_type first = 0, last = N;
+    while (first < last) {
+      size_type mid = first + (last - first) / 2;
+      if (Compare{}(keys[mid], key))
+        first = mid + 1;
+      else
+        last = mid;
+    }
+    return first;
+  }
+
+  array<Key, N> keys;
+};
+
+template <class Key, std::size_t N>
+constexpr static_set<Key, N> make_static_set(const Key (&items)[N]) {
+  return static_set<Key, N>(items);
+}
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_STATIC_SET_H_
@@ -0,0 +1,533 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_SWISS_TABLE_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_SWISS_TABLE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+/* 16 control bytes probed at once: SSE2 compares all of them with one
+ * instruction, the fallback loop builds the same bit masks.
+ *
+ * A control byte is kEmpty, kDeleted (a tombstone) or, for a full slot, the
+ * low 7 bits of the element's hash (h2).
+ */
+class swiss_group {
+ public:
+  static constexpr std::size_t kWidth = 16;
+  static constexpr signed char kEmpty = -128;
+  static constexpr signed char kDeleted = -2;
+
+  explicit swiss_group(const signed char* ctrl) {
+#ifdef __SSE2__
+    g = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+    for (std::size_t i = 0; i < kWidth; ++i) b[i] = ctrl[i];
+#endif
+  }
+
+  /* Bit i is set when control byte i equals h2 */
+  unsigned match(signed char h2) const {
+#ifdef __SSE2__
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), g));
+#else
+    return mask([h2](signed char c) { return c == h2; });
+#endif
+  }
+
+  unsigned match_empty() const {
+#ifdef __SSE2__
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kEmpty), g));
+#else
+    return mask([](signed char c) { return c == kEmpty; });
+#endif
+  }
+
+  unsigned match_empty_or_deleted() const {
+#ifdef __SSE2__
+    return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), g));
+#else
+    return mask([](signed char c) { return c < -1; });
+#endif
+  }
+
+ private:
+#ifdef __SSE2__
+  __m128i g;
+#else
+  template <class Pred>
+  unsigned mask(Pred pred) const {
+    unsigned m = 0;
+    for (std::size_t i = 0; i < kWidth; ++i)
+      if (pred(b[i])) m |= 1u << i;
+    return m;
+  }
+
+  signed char b[kWidth];
+#endif
+};
+
+/* True when F declares is_transparent, i.e. accepts keys of other types */
+template <class F, class = void>
+struct is_transparent : std::false_type {};
+
+template <class F>
+struct is_transparent<F, std::void_t<typename F::is_transparent>>
+    : std::true_type {};
+
+/* Moving a stored element into a new slot. A map stores
+ * pair<const Key, T>, whose own move constructor copies the key; take()
+ * moves the key as well, and is only used on an element whose slot is
+ * destroyed right after. */
+template <class V>
+struct swiss_slot {
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_constructible<V>::value;
+
+  static V&& take(V& v) noexcept { return std::move(v); }
+};
+
+template <class K, class T>
+struct swiss_slot<std::pair<const K, T>> {
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_constructible<K>::value &&
+      std::is_nothrow_move_constructible<T>::value;
+
+  static std::pair<K&&, T&&> take(std::pair<const K, T>& v) noexcept {
+    return std::pair<K&&, T&&>(std::move(const_cast<K&>(v.first)),
+                               std::move(v.second));
+  }
+};
+
+/* Open-addressing hash table in the style of Swiss tables. Slots are split
+ * into aligned groups of 16; a key probes groups h1, h1 + 1, h1 + 3, ...
+ * (triangular steps visit every group of a power-of-two table) and stops at
+ * the first group that has an empty slot. Only slots whose control byte
+ * matches h2 are compared with the key.
+ *
+ * KeyOf extracts the key from a stored Value, so the same table backs
+ * unordered_set (Value = Key) and unordered_map (Value = pair).
+ */
+template <class Value, class Key, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+class swiss_table {
+  struct alignas(16) ctrl_block {
+    signed char bytes[swiss_group::kWidth];
+  };
+
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<
+      Value>
+      slot_allocator;
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<
+      ctrl_block>
+      ctrl_allocator;
+
+ public:
+  typedef std::size_t size_type;
+
+  static constexpr float kDefaultLoadFactor = 0.875f;
+
+  template <bool Const>
+  class basic_iterator;
+  typedef basic_iterator<false> iterator;
+  typedef basic_iterator<true> const_iterator;
+
+  swiss_table()
+      : ctrl{nullptr},
+        slots{nullptr},
+        group_count{0},
+        sz{0},
+        growth_left{0},
+        load_factor{kDefaultLoadFactor},
+        hasher{},
+        eq{},
+        slot_alloc{},
+        ctrl_alloc{} {}
+
+  swiss_table(const swiss_table& other) : swiss_table() {
+    load_factor = other.load_factor;
+    hasher = other.hasher;
+    eq = other.eq;
+    reserve(other.sz);
+    for (size_type i = 0; i < other.capacity(); ++i)
+      if (other.ctrl[i] >= 0) insert_unique(other.slots[i]);
+  }
+
+  swiss_table(swiss_table&& other) noexcept : swiss_table() { swap(other); }
+
+  swiss_table& operator=(const swiss_table& other) {
+    if (this != &other) {
+      swiss_table tmp{other};
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  swiss_table& operator=(swiss_table&& other) noexcept {
+    if (this != &other) {
+      swiss_table tmp{std::move(other)};
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~swiss_table() { release(); }
+
+  iterator begin() noexcept { return iterator(this, skip(0)); }
+  const_iterator begin() const noexcept {
+    return const_iterator(this, skip(0));
+  }
+  iterator end() noexcept { return iterator(this, capacity()); }
+  const_iterator end() const noexcept {
+    return const_iterator(this, capacity());
+  }
+
+  bool empty() const noexcept { return sz == 0; }
+  size_type size() const noexcept { return sz; }
+  size_type capacity() const noexcept {
+    return group_count * swiss_group::kWidth;
+  }
+
+  float max_load_factor() const noexcept { return load_factor; }
+
+  /* Clamped to [0.25, 0.9375]: at least one slot in 16 stays empty so that
+   * unsuccessful probes terminate */
+  void max_load_factor(float ml) {
+    size_type dead = tombstones();
+    load_factor = ml < 0.25f ? 0.25f : ml > 0.9375f ? 0.9375f : ml;
+    if (sz + dead > max_elements(group_count))
+      resize(groups_for(sz));
+    else
+      growth_left = max_elements(group_count) - sz - dead;
+  }
+
+  void clear() noexcept {
+    for (size_type i = 0; i < capacity(); ++i) {
+      if (ctrl[i] >= 0)
+        std::allocator_traits<slot_allocator>::destroy(slot_alloc, slots + i);
+      ctrl[i] = swiss_group::kEmpty;
+    }
+    sz = 0;
+    growth_left = max_elements(group_count);
+  }
+
+  /* Makes room for n elements without further rehashing */
+  void reserve(size_type n) {
+    if (n <= sz + growth_left) return;
+    resize(std::max(groups_for(n), group_count));
+  }
+
+  /* Rebuilds the table for max(n, size()) elements, dropping tombstones */
+  void rehash(size_type n) {
+    if (group_count != 0 || n != 0) resize(groups_for(std::max(n, sz)));
+  }
+
+  /* Slot holding key, or capacity() */
+  template <class K>
+  size_type find_slot(const K& key) const {
+    if (sz == 0) return capacity();
+    return find_hashed(key, hash_of(key));
+  }
+
+  /* Inserts v unless its key is present; returns the slot and whether the
+   * element was inserted */
+  template <class V>
+  std::pair<size_type, bool> insert_unique(V&& v) {
+    const auto& key = KeyOf()(v);
+    const std::size_t h = hash_of(key);
+    size_type found = sz == 0 ? capacity() : find_hashed(key, h);
+    if (found != capacity()) return std::make_pair(found, false);
+
+    size_type i = prepare_insert(h);
+    std::allocator_traits<slot_allocator>::construct(slot_alloc, slots + i,
+                                                     std::forward<V>(v));
+    mark_full(i, h);
+    return std::make_pair(i, true);
+  }
+
+  /* Inserts an element built from args under key, which must be absent.
+   * When the table is about to grow the element is built before the slots
+   * move, so args may refer to elements of the table. */
+  template <class... Args>
+  size_type emplace_new(const Key& key, Args&&... args) {
+    const std::size_t h = hash_of(key);
+    size_type i;
+    if (growth_left == 0) {
+      Value v(std::forward<Args>(args)...);
+      i = prepare_insert(h);
+      std::allocator_traits<slot_allocator>::construct(
+          slot_alloc, slots + i, swiss_slot<Value>::take(v));
+    } else {
+      i = prepare_insert(h);
+      std::allocator_traits<slot_allocator>::construct(
+          slot_alloc, slots + i, std::forward<Args>(args)...);
+    }
+    mark_full(i, h);
+    return i;
+  }
+
+  void erase_slot(size_type i) {
+    std::allocator_traits<slot_allocator>::destroy(slot_alloc, slots + i);
+    --sz;
+
+    // no probe sequence continues past a group that still has an empty slot,
+    // so such a slot can go back to empty instead of becoming a tombstone
+    size_type g = i / swiss_group::kWidth;
+    if (swiss_group(ctrl + g * swiss_group::kWidth).match_empty() != 0) {
+      ctrl[i] = swiss_group::kEmpty;
+      ++growth_left;
+    } else {
+      ctrl[i] = swiss_group::kDeleted;
+    }
+  }
+
+  Value& slot(size_type i) { return slots[i]; }
+  const Value& slot(size_type i) const { return slots[i]; }
+
+  const Hash& hash_function() const { return hasher; }
+  const KeyEqual& key_eq() const { return eq; }
+
+  void swap(swiss_table& other) noexcept {
+    std::swap(ctrl, other.ctrl);
+    std::swap(slots, other.slots);
+    std::swap(group_count, other.group_count);
+    std::swap(sz, other.sz);
+    std::swap(growth_left, other.growth_left);
+    std::swap(load_factor, other.load_factor);
+    std::swap(hasher, other.hasher);
+    std::swap(eq, other.eq);
+    std::swap(slot_alloc, other.slot_alloc);
+    std::swap(ctrl_alloc, other.ctrl_alloc);
+  }
+
+  template <bool Const>
+  class basic_iterator {
+    typedef typename std::conditional<Const, const swiss_table*,
+                                      swiss_table*>::type table_ptr;
+
+   public:
+    typedef std::ptrdiff_t difference_type;
+    typedef Value value_type;
+    typedef typename std::conditional<Const, const Value&, Value&>::type
+        reference;
+    typedef typename std::conditional<Const, const Value*, Value*>::type
+        pointer;
+    typedef std::forward_iterator_tag iterator_category;
+
+    basic_iterator() : t{nullptr}, i{0} {}
+    basic_iterator(table_ptr table, size_type index) : t{table}, i{index} {}
+
+    // iterator -> const_iterator
+    template <bool C = Const, class = typename std::enable_if<C>::type>
+    basic_iterator(const basic_iterator<false>& other)
+        : t{other.table()}, i{other.index()} {}
+
+    bool operator==(const basic_iterator& other) const {
+      return i == other.i && t == other.t;
+    }
+    bool operator!=(const basic_iterator& other) const {
+      return !(*this == other);
+    }
+
+    basic_iterator& operator++() {
+      i = t->skip(i + 1);
+      return *this;
+    }
+
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      i = t->skip(i + 1);
+      return tmp;
+    }
+
+    reference operator*() const { return t->slots[i]; }
+    pointer operator->() const { return t->slots + i; }
+
+    table_ptr table() const { return t; }
+    size_type index() const { return i; }
+
+   private:
+    table_ptr t;
+    size_type i;
+  };
+
+ private:
+  // 64-bit finalizer from MurmurHash3: std::hash of integers is the
+  // identity, and both h1 (group) and h2 (tag) need well-mixed bits
+  template <class K>
+  std::size_t hash_of(const K& key) const {
+    std::uint64_t h = hasher(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+  }
+
+  template <class K>
+  size_type find_hashed(const K& key, std::size_t h) const {
+    const signed char h2 = static_cast<signed char>(h & 0x7f);
+    const size_type mask = group_count - 1;
+    size_type g = (h >> 7) & mask;
+
+    for (size_type step = 1;; ++step) {
+      const signed char* block = ctrl + g * swiss_group::kWidth;
+      swiss_group group(block);
+      for (unsigned m = group.match(h2); m != 0; m &= m - 1) {
+        size_type i = g * swiss_group::kWidth + __builtin_ctz(m);
+        if (eq(KeyOf()(slots[i]), key)) return i;
+      }
+      if (group.match_empty() != 0) return capacity();
+      g = (g + step) & mask;
+    }
+  }
+
+  // first full slot at or after i
+  size_type skip(size_type i) const {
+    while (i < capacity() && ctrl[i] < 0) ++i;
+    return i;
+  }
+
+  size_type max_elements(size_type groups) const {
+    return static_cast<size_type>(groups * swiss_group::kWidth * load_factor);
+  }
+
+  size_type tombstones() const {
+    return max_elements(group_count) - sz - growth_left;
+  }
+
+  size_type groups_for(size_type n) const {
+    size_type groups = 1;
+    while (max_elements(groups) < n) groups *= 2;
+    return groups;
+  }
+
+  // free slot for a new element with hash h, growing the table first if it
+  // is full; the slot is claimed by mark_full once the element is built
+  size_type prepare_insert(std::size_t h) {
+    if (growth_left == 0) {
+      // mostly tombstones: clean them up without growing
+      if (group_count != 0 && sz <= max_elements(group_count) / 2)
+        resize(group_count);
+      else
+        resize(group_count == 0 ? 1 : group_count * 2);
+    }
+    return free_slot(ctrl, group_count, h);
+  }
+
+  // tags slot i with h2 of h
+  void mark_full(size_type i, std::size_t h) noexcept {
+    if (ctrl[i] == swiss_group::kEmpty) --growth_left;
+    ctrl[i] = static_cast<signed char>(h & 0x7f);
+    ++sz;
+  }
+
+  // first empty or deleted slot on the probe sequence of h
+  static size_type free_slot(const signed char* c, size_type groups,
+                             std::size_t h) {
+    const size_type mask = groups - 1;
+    size_type g = (h >> 7) & mask;
+    for (size_type step = 1;; ++step) {
+      swiss_group group(c + g * swiss_group::kWidth);
+      unsigned m = group.match_empty_or_deleted();
+      if (m != 0) return g * swiss_group::kWidth + __builtin_ctz(m);
+      g = (g + step) & mask;
+    }
+  }
+
+  // Elements move into the new slots only when that cannot throw, and are
+  // copied otherwise. The new arrays replace the old ones once every
+  // element is in; if anything throws they are dropped and the table is
+  // left as it was.
+  void resize(size_type groups) {
+    const size_type new_capacity = groups * swiss_group::kWidth;
+    ctrl_block* blocks = ctrl_alloc.allocate(groups);
+    Value* new_slots;
+    try {
+      new_slots = slot_alloc.allocate(new_capacity);
+    } catch (...) {
+      ctrl_alloc.deallocate(blocks, groups);
+      throw;
+    }
+    signed char* new_ctrl = blocks->bytes;
+    std::fill(new_ctrl, new_ctrl + new_capacity, swiss_group::kEmpty);
+
+    try {
+      for (size_type i = 0; i < capacity(); ++i) {
+        if (ctrl[i] < 0) continue;
+        const std::size_t h = hash_of(KeyOf()(slots[i]));
+        size_type j = free_slot(new_ctrl, groups, h);
+        relocate(new_slots + j, slots[i]);
+        new_ctrl[j] = static_cast<signed char>(h & 0x7f);
+      }
+    } catch (...) {
+      for (size_type j = 0; j < new_capacity; ++j)
+        if (new_ctrl[j] >= 0)
+          std::allocator_traits<slot_allocator>::destroy(slot_alloc,
+                                                         new_slots + j);
+      slot_alloc.deallocate(new_slots, new_capacity);
+      ctrl_alloc.deallocate(blocks, groups);
+      throw;
+    }
+
+    if (group_count != 0) {
+      for (size_type i = 0; i < capacity(); ++i)
+        if (ctrl[i] >= 0)
+          std::allocator_traits<slot_allocator>::destroy(slot_alloc,
+                                                         slots + i);
+      ctrl_alloc.deallocate(reinterpret_cast<ctrl_block*>(ctrl), group_count);
+      slot_alloc.deallocate(slots, capacity());
+    }
+    ctrl = new_ctrl;
+    slots = new_slots;
+    group_count = groups;
+    growth_left = max_elements(groups) - sz;
+  }
+
+  // builds *dst from src for resize; move-only elements are moved even if
+  // that may throw
+  void relocate(Value* dst, Value& src) {
+    if constexpr (swiss_slot<Value>::kNothrowMove ||
+                  !std::is_copy_constructible<Value>::value)
+      std::allocator_traits<slot_allocator>::construct(
+          slot_alloc, dst, swiss_slot<Value>::take(src));
+    else
+      std::allocator_traits<slot_allocator>::construct(
+          slot_alloc, dst, static_cast<const Value&>(src));
+  }
+
+  void release() noexcept {
+    if (group_count == 0) return;
+    clear();
+    ctrl_alloc.deallocate(reinterpret_cast<ctrl_block*>(ctrl), group_count);
+    slot_alloc.deallocate(slots, capacity());
+    ctrl = nullptr;
+    slots = nullptr;
+    group_count = 0;
+    growth_left = 0;
+  }
+
+  signed char* ctrl;
+  Value* slots;
+  size_type group_count;
+  size_type sz;
+  size_type growth_left;
+  float load_factor;
+  Hash hasher;
+  KeyEqual eq;
+  slot_allocator slot_alloc;
+  ctrl_allocator ctrl_alloc;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_SWISS_TABLE_H_
@@ -0,0 +1,158 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_THREAD_POOL_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "../containers/vector.h"
+
+namespace s21 {
+
+/* Work-stealing thread pool. Every worker owns a task deque: it pushes and
+ * pops its own tasks at the back (the most recent, cache-warm one first)
+ * and, when that runs dry, steals the oldest task from the front of another
+ * worker's deque. Tasks submitted from outside the pool are dealt to the
+ * workers round-robin.
+ *
+ * A thread waiting for its tasks should call run_pending_task() in a loop
+ * instead of blocking, so that fork-join code nested inside tasks cannot
+ * run out of threads.
+ */
+class thread_pool {
+  struct alignas(64) task_queue {
+    std::mutex m;
+    std::deque<std::function<void()>> tasks;
+  };
+
+ public:
+  explicit thread_pool(std::size_t workers)
+      : queues{new task_queue[workers == 0 ? 1 : workers]},
+        queue_count{workers == 0 ? 1 : workers} {
+    threads.reserve(workers);
+    try {
+      for (std::size_t i = 0; i < workers; ++i)
+        threads.emplace_back([this, i] { worker_loop(i); });
+    } catch (...) {
+      join_workers();  // the workers started so far
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  /* Runs the tasks still queued, then joins the workers */
+  ~thread_pool() {
+    join_workers();
+    while (run_pending_task()) {
+    }
+  }
+
+  /* Number of worker threads */
+  std::size_t size() const noexcept { return threads.size(); }
+
+  void submit(std::function<void()> task) {
+    std::size_t q = current.pool == this
+                        ? current.index
+                        : next_queue.fetch_add(1, std::memory_order_relaxed) %
+                              queue_count;
+    // counted before it is queued, so pending never drops below the number
+    // of queued tasks; seq_cst pairs with the sleeping/pending order in
+    // worker_loop: either the worker sees the task or this sees it asleep
+    pending.fetch_add(1);
+    try {
+      std::lock_guard<std::mutex> lock(queues[q].m);
+      queues[q].tasks.push_back(std::move(task));
+    } catch (...) {
+      pending.fetch_sub(1);
+      throw;
+    }
+    if (sleeping.load() != 0) {
+      std::lock_guard<std::mutex> lock(sleep_m);
+      wake.notify_one();
+    }
+  }
+
+  /* Runs one queued task, if any: the calling worker's own newest task,
+   * else one stolen from another queue. Returns whether it ran one. */
+  bool run_pending_task() {
+    std::function<void()> task;
+    if (!take(task)) return false;
+    task();
+    return true;
+  }
+
+ private:
+  /* Wakes the workers to stop once the queues are empty and joins them */
+  void join_workers() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(sleep_m);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : threads) t.join();
+  }
+
+  // zero-initialized as a thread_local: no pool
+  struct worker_id {
+    const thread_pool* pool;
+    std::size_t index;
+  };
+
+  static inline thread_local worker_id current;
+
+  bool take(std::function<void()>& task) {
+    if (pending.load(std::memory_order_acquire) == 0) return false;
+    const bool own = current.pool == this;
+    const std::size_t start = own ? current.index : 0;
+    for (std::size_t k = 0; k < queue_count; ++k) {
+      task_queue& q = queues[(start + k) % queue_count];
+      std::lock_guard<std::mutex> lock(q.m);
+      if (q.tasks.empty()) continue;
+      if (own && k == 0) {
+        task = std::move(q.tasks.back());
+        q.tasks.pop_back();
+      } else {
+        task = std::move(q.tasks.front());
+        q.tasks.pop_front();
+      }
+      pending.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  void worker_loop(std::size_t index) {
+    current.pool = this;
+    current.index = index;
+    for (;;) {
+      if (run_pending_task()) continue;
+      std::unique_lock<std::mutex> lock(sleep_m);
+      sleeping.fetch_add(1);
+      wake.wait(lock, [this] { return stopping || pending.load() != 0; });
+      sleeping.fetch_sub(1);
+      if (stopping && pending.load(std::memory_order_acquire) == 0) break;
+    }
+    current.pool = nullptr;
+  }
+
+  std::unique_ptr<task_queue[]> queues;
+  const std::size_t queue_count;
+  vector<std::thread> threads;
+  std::atomic<std::size_t> pending{0};
+  std::atomic<std::size_t> next_queue{0};
+  std::atomic<unsigned> sleeping{0};
+  std::mutex sleep_m;
+  std::condition_variable wake;
+  bool stopping = false;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_THREAD_POOL_H_
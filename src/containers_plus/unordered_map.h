@@ -0,0 +1,199 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_UNORDERED_MAP_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_UNORDERED_MAP_H_
+
+#include <initializer_list>
+#include <tuple>
+
+#include "swiss_table.h"
+
+namespace s21 {
+
+/* Hash map on an open-addressing Swiss table (see swiss_table.h). Elements
+ * live in a flat slot array, so rehashing invalidates iterators and
+ * references. Lookups with a key of another type are enabled when both Hash
+ * and KeyEqual define is_transparent.
+ */
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+  struct key_of {
+    template <class P>
+    const typename P::first_type& operator()(const P& p) const {
+      return p.first;
+    }
+  };
+
+  typedef swiss_table<std::pair<const Key, T>, Key, key_of, Hash, KeyEqual,
+                      Allocator>
+      table_type;
+
+  static constexpr bool kTransparent =
+      is_transparent<Hash>::value && is_transparent<KeyEqual>::value;
+
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Allocator allocator_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename table_type::iterator iterator;
+  typedef typename table_type::const_iterator const_iterator;
+
+  unordered_map() : table{} {}
+
+  explicit unordered_map(size_type n) : table{} { table.reserve(n); }
+
+  unordered_map(std::initializer_list<value_type> init) : table{} {
+    table.reserve(init.size());
+    for (const value_type& v : init) table.insert_unique(v);
+  }
+
+  unordered_map& operator=(std::initializer_list<value_type> init) {
+    unordered_map tmp{init};
+    swap(tmp);
+    return *this;
+  }
+
+  T& at(const Key& key) {
+    size_type i = table.find_slot(key);
+    if (i == table.capacity()) throw std::out_of_range("unordered_map::at");
+    return table.slot(i).second;
+  }
+
+  const T& at(const Key& key) const {
+    size_type i = table.find_slot(key);
+    if (i == table.capacity()) throw std::out_of_range("unordered_map::at");
+    return table.slot(i).second;
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+  iterator begin() noexcept { return table.begin(); }
+  const_iterator begin() const noexcept { return table.begin(); }
+  const_iterator cbegin() const noexcept { return table.begin(); }
+  iterator end() noexcept { return table.end(); }
+  const_iterator end() const noexcept { return table.end(); }
+  const_iterator cend() const noexcept { return table.end(); }
+
+  bool empty() const noexcept { return table.empty(); }
+  size_type size() const noexcept { return table.size(); }
+
+  void clear() noexcept { table.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return wrap(table.insert_unique(value));
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return wrap(table.insert_unique(std::move(value)));
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    std::pair<iterator, bool> res = try_emplace(key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+
+  /* Constructs the value from args only if key is absent */
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    size_type i = table.find_slot(key);
+    if (i != table.capacity())
+      return std::make_pair(iterator(&table, i), false);
+    i = table.emplace_new(key, std::piecewise_construct,
+                          std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+    return std::make_pair(iterator(&table, i), true);
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  size_type erase(const Key& key) {
+    size_type i = table.find_slot(key);
+    if (i == table.capacity()) return 0;
+    table.erase_slot(i);
+    return 1;
+  }
+
+  /* Erasing never moves other elements, so pos stays usable for ++ */
+  iterator erase(const_iterator pos) {
+    table.erase_slot(pos.index());
+    iterator it(&table, pos.index());
+    return ++it;
+  }
+
+  void swap(unordered_map& other) noexcept { table.swap(other.table); }
+
+  iterator find(const Key& key) {
+    return iterator(&table, table.find_slot(key));
+  }
+
+  const_iterator find(const Key& key) const {
+    return const_iterator(&table, table.find_slot(key));
+  }
+
+  template <class K, bool B = kTransparent,
+            class = typename std::enable_if<B>::type>
+  iterator find(const K& key) {
+    return iterator(&table, table.find_slot(key));
+  }
+
+  template <class K, bool B = kTransparent,
+            class = typename std::enable_if<B>::type>
+  const_iterator find(const K& key) const {
+    return const_iterator(&table, table.find_slot(key));
+  }
+
+  bool contains(const Key& key) const {
+    return table.find_slot(key) != table.capacity();
+  }
+
+  template <class K, bool B = kTransparent,
+            class = typename std::enable_if<B>::type>
+  bool contains(const K& key) const {
+    return table.find_slot(key) != table.capacity();
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  /* Hash policy */
+
+  size_type bucket_count() const noexcept { return table.capacity(); }
+
+  float load_factor() const noexcept {
+    return table.capacity() == 0
+               ? 0.0f
+               : static_cast<float>(size()) / table.capacity();
+  }
+
+  float max_load_factor() const noexcept { return table.max_load_factor(); }
+
+  void max_load_factor(float ml) { table.max_load_factor(ml); }
+
+  void reserve(size_type n) { table.reserve(n); }
+
+  void rehash(size_type n) { table.rehash(n); }
+
+  hasher hash_function() const { return table.hash_function(); }
+
+  key_equal key_eq() const { return table.key_eq(); }
+
+ private:
+  std::pair<iterator, bool> wrap(std::pair<size_type, bool> res) {
+    return std::make_pair(iterator(&table, res.first), res.second);
+  }
+
+  table_type table;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_UNORDERED_MAP_H_
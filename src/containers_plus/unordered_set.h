@@ -0,0 +1,143 @@
+#ifndef _STL_CONTAINERS_CONTAINERS_PLUS_UNORDERED_SET_H_
+#define _STL_CONTAINERS_CONTAINERS_PLUS_UNORDERED_SET_H_
+
+#include <initializer_list>
+
+#include "swiss_table.h"
+
+namespace s21 {
+
+/* Hash set on an open-addressing Swiss table, see unordered_map.h */
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class unordered_set {
+  struct key_of {
+    const Key& operator()(const Key& key) const { return key; }
+  };
+
+  typedef swiss_table<Key, Key, key_of, Hash, KeyEqual, Allocator> table_type;
+
+  static constexpr bool kTransparent =
+      is_transparent<Hash>::value && is_transparent<KeyEqual>::value;
+
+ public:
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef std::size_t size_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Allocator allocator_type;
+  typedef const value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename table_type::const_iterator iterator;
+  typedef typename table_type::const_iterator const_iterator;
+
+  unordered_set() : table{} {}
+
+  explicit unordered_set(size_type n) : table{} { table.reserve(n); }
+
+  unordered_set(std::initializer_list<value_type> init) : table{} {
+    table.reserve(init.size());
+    for (const value_type& v : init) table.insert_unique(v);
+  }
+
+  unordered_set& operator=(std::initializer_list<value_type> init) {
+    unordered_set tmp{init};
+    swap(tmp);
+    return *this;
+  }
+
+  const_iterator begin() const noexcept { return table.begin(); }
+  const_iterator cbegin() const noexcept { return table.begin(); }
+  const_iterator end() const noexcept { return table.end(); }
+  const_iterator cend() const noexcept { return table.end(); }
+
+  bool empty() const noexcept { return table.empty(); }
+  size_type size() const noexcept { return table.size(); }
+
+  void clear() noexcept { table.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return wrap(table.insert_unique(value));
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return wrap(table.insert_unique(std::move(value)));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  size_type erase(const Key& key) {
+    size_type i = table.find_slot(key);
+    if (i == table.capacity()) return 0;
+    table.erase_slot(i);
+    return 1;
+  }
+
+  iterator erase(const_iterator pos) {
+    table.erase_slot(pos.index());
+    const_iterator it(&table, pos.index());
+    return ++it;
+  }
+
+  void swap(unordered_set& other) noexcept { table.swap(other.table); }
+
+  const_iterator find(const Key& key) const {
+    return const_iterator(&table, table.find_slot(key));
+  }
+
+  template <class K, bool B = kTransparent,
+            class = typename std::enable_if<B>::type>
+  const_iterator find(const K& key) const {
+    return const_iterator(&table, table.find_slot(key));
+  }
+
+  bool contains(const Key& key) const {
+    return table.find_slot(key) != table.capacity();
+  }
+
+  template <class K, bool B = kTransparent,
+            class = typename std::enable_if<B>::type>
+  bool contains(const K& key) const {
+    return table.find_slot(key) != table.capacity();
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  /* Hash policy */
+
+  size_type bucket_count() const noexcept { return table.capacity(); }
+
+  float load_factor() const noexcept {
+    return table.capacity() == 0
+               ? 0.0f
+               : static_cast<float>(size()) / table.capacity();
+  }
+
+  float max_load_factor() const noexcept { return table.max_load_factor(); }
+
+  void max_load_factor(float ml) { table.max_load_factor(ml); }
+
+  void reserve(size_type n) { table.reserve(n); }
+
+  void rehash(size_type n) { table.rehash(n); }
+
+  hasher hash_function() const { return table.hash_function(); }
+
+  key_equal key_eq() const { return table.key_eq(); }
+
+ private:
+  std::pair<iterator, bool> wrap(std::pair<size_type, bool> res) const {
+    return std::make_pair(const_iterator(&table, res.first), res.second);
+  }
+
+  table_type table;
+};
+
+}  // namespace s21
+
+#endif  // _STL_CONTAINERS_CONTAINERS_PLUS_UNORDERED_SET_H_
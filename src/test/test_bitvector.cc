@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../containers_plus/bitvector.h"
+#include "../containers_plus/simd.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+std::vector<bool> random_bits(std::size_t n, unsigned seed, unsigned density) {
+  std::mt19937 gen(seed);
+  std::vector<bool> res(n);
+  for (std::size_t i = 0; i < n; ++i) res[i] = gen() % 100 < density;
+  return res;
+}
+
+s21::bitvector from(const std::vector<bool>& bits) {
+  s21::bitvector res;
+  for (bool b : bits) res.push_back(b);
+  return res;
+}
+
+void expect_same(const s21::bitvector& got, const std::vector<bool>& want) {
+  ASSERT_EQ(got.size(), want.size());
+  for (std::size_t i = 0; i < want.size(); ++i) ASSERT_EQ(got[i], want[i]) << i;
+}
+
+const s21::simd::level kLevels[] = {s21::simd::level::scalar,
+                                    s21::simd::level::sse2,
+                                    s21::simd::level::avx2,
+                                    s21::simd::level::avx512};
+
+class BitvectorLevels : public ::testing::TestWithParam<s21::simd::level> {
+ protected:
+  void SetUp() override { s21::simd::set_level(GetParam()); }
+  void TearDown() override {
+    s21::simd::set_level(s21::simd::detected_level());
+  }
+};
+
+}  // namespace
+
+TEST(Bitvector, constructors) {
+  s21::bitvector empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_GT(empty.max_size(), s21::vector<std::uint64_t>().max_size());
+  EXPECT_EQ(empty.find_first(), s21::bitvector::npos);
+
+  s21::bitvector ones(70, true);
+  EXPECT_EQ(ones.size(), 70u);
+  EXPECT_EQ(ones.word_size(), 2u);
+  EXPECT_EQ(ones.count(), 70u);
+  EXPECT_EQ(ones.data()[1], (std::uint64_t(1) << 6) - 1);
+  EXPECT_TRUE(ones.all());
+
+  s21::bitvector list = {true, false, true};
+  EXPECT_EQ(list.size(), 3u);
+  EXPECT_TRUE(list[0]);
+  EXPECT_FALSE(list[1]);
+  EXPECT_EQ(list.count(), 2u);
+}
+
+TEST(Bitvector, proxy_reference) {
+  s21::bitvector v(100);
+  v[3] = true;
+  v[64] = v[3];
+  EXPECT_TRUE(v[64]);
+  v[3].flip();
+  EXPECT_FALSE(v[3]);
+  EXPECT_TRUE(~v[3]);
+  v.at(99) = true;
+  EXPECT_TRUE(v.back());
+  EXPECT_THROW(v.at(100), std::out_of_range);
+  EXPECT_THROW(v.set(100), std::out_of_range);
+  EXPECT_EQ(v.count(), 2u);
+
+  for (auto b : v) b = true;
+  EXPECT_TRUE(v.all());
+  const s21::bitvector& c = v;
+  std::size_t set = 0;
+  for (bool b : c) set += b;
+  EXPECT_EQ(set, 100u);
+  EXPECT_EQ(c.end() - c.begin(), 100);
+}
+
+TEST(Bitvector, push_pop_resize) {
+  std::vector<bool> want = random_bits(300, 1, 50);
+  s21::bitvector v = from(want);
+  expect_same(v, want);
+  for (int i = 0; i < 150; ++i) {
+    v.pop_back();
+    want.pop_back();
+  }
+  expect_same(v, want);
+  EXPECT_EQ(v.count(), std::size_t(std::count(want.begin(), want.end(), true)));
+
+  v.resize(200, true);
+  want.resize(200, true);
+  expect_same(v, want);
+  v.resize(65);
+  want.resize(65);
+  expect_same(v, want);
+  v.resize(130);
+  want.resize(130);
+  expect_same(v, want);
+  v.clear();
+  EXPECT_EQ(v.size(), 0u);
+  EXPECT_EQ(v.count(), 0u);
+}
+
+TEST(Bitvector, find) {
+  s21::bitvector v(1000);
+  const std::size_t set[] = {0, 63, 64, 200, 511, 999};
+  for (std::size_t i : set) v.set(i);
+  std::size_t k = 0;
+  for (std::size_t i = v.find_first(); i != s21::bitvector::npos;
+       i = v.find_next(i))
+    ASSERT_EQ(i, set[k++]);
+  EXPECT_EQ(k, 6u);
+  EXPECT_EQ(v.find_next(999), s21::bitvector::npos);
+  EXPECT_EQ(v.find_next(5000), s21::bitvector::npos);
+  v.reset();
+  EXPECT_TRUE(v.none());
+  v.set();
+  EXPECT_EQ(v.count(), 1000u);
+}
+
+TEST_P(BitvectorLevels, bitwise_against_std) {
+  for (std::size_t n : {0, 1, 63, 64, 65, 127, 300, 1000, 4099}) {
+    std::vector<bool> a = random_bits(n, 2, 30), b = random_bits(n, 3, 60);
+    s21::bitvector va = from(a), vb = from(b);
+    std::vector<bool> and_(n), or_(n), xor_(n), not_(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      and_[i] = a[i] && b[i];
+      or_[i] = a[i] || b[i];
+      xor_[i] = a[i] != b[i];
+      not_[i] = !a[i];
+    }
+    expect_same(va & vb, and_);
+    expect_same(va | vb, or_);
+    expect_same(va ^ vb, xor_);
+    s21::bitvector inverted = ~va;
+    expect_same(inverted, not_);
+    EXPECT_EQ(inverted.count(), n - va.count());
+    EXPECT_EQ(va.count(), std::size_t(std::count(a.begin(), a.end(), true)));
+    EXPECT_EQ(~inverted, va);
+  }
+}
+
+TEST_P(BitvectorLevels, size_mismatch) {
+  s21::bitvector a(10), b(11);
+  EXPECT_THROW(a &= b, std::invalid_argument);
+  EXPECT_THROW(a |= b, std::invalid_argument);
+  EXPECT_THROW(a ^= b, std::invalid_argument);
+}
+
+INSTANTIATE_TEST_SUITE_P(Levels, BitvectorLevels, ::testing::ValuesIn(kLevels));
@@ -0,0 +1,207 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "../containers_plus/compact_map.h"
+#include "../containers_plus/compact_set.h"
+#include "gtest/gtest.h"
+
+TEST(TestCompactTree, node_is_smaller) {
+  ASSERT_LE(sizeof(s21::compact_tree<int, int>::node), 24);
+}
+
+TEST(TestCompactTree, random_against_std) {
+  s21::compact_map<int, int> m;
+  std::map<int, int> ref;
+  std::mt19937 gen(39);
+  for (int i = 0; i < 20000; ++i) {
+    int k = gen() % 3000;
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(m.erase(k), ref.erase(k));
+    } else {
+      m.insert_or_assign(k, i);
+      ref[k] = i;
+    }
+  }
+  ASSERT_GT(m.get_tree().verify(), 0);
+  ASSERT_EQ(m.size(), ref.size());
+  // erased nodes are reused: the arena never exceeds the peak size
+  ASSERT_LE(m.get_tree().arena_size(), 3000u);
+
+  auto it = m.begin();
+  for (auto& kv : ref) {
+    ASSERT_EQ(*it, kv.first);
+    ASSERT_EQ(it.value(), kv.second);
+    ++it;
+  }
+  ASSERT_EQ(it, m.end());
+  --it;
+  ASSERT_EQ(*it, ref.rbegin()->first);
+
+  for (int k = -5; k < 3005; k += 7) {
+    auto lb = ref.lower_bound(k);
+    auto got = m.lower_bound(k);
+    if (lb == ref.end())
+      ASSERT_EQ(got, m.end());
+    else
+      ASSERT_EQ(*got, lb->first);
+  }
+}
+
+TEST(TestCompactTree, map_interface) {
+  s21::compact_map<std::string, int> m{{"b", 2}, {"a", 1}};
+  m["c"] = 3;
+  ASSERT_EQ(m.at("c"), 3);
+  ASSERT_THROW(m.at("d"), std::out_of_range);
+  ASSERT_FALSE(m.insert({"a", 10}).second);
+  ASSERT_EQ(m.at("a"), 1);
+  ASSERT_TRUE(m.contains("b"));
+
+  auto it = m.erase(m.find("a"));
+  ASSERT_EQ(*it, "b");
+  ASSERT_EQ(*m.begin(), "b");
+
+  s21::compact_map<std::string, int> copy = m;
+  m.clear();
+  ASSERT_EQ(copy.size(), 2);
+  ASSERT_EQ(*copy.upper_bound("b"), "c");
+}
+
+TEST(TestCompactTree, set_write_and_read) {
+  s21::compact_set<long> s{5, 1, 9, 3};
+  s.erase(9);
+  std::stringstream buf;
+  s.write(buf);
+
+  s21::compact_set<long> loaded;
+  loaded.read(buf);
+  ASSERT_EQ(loaded.size(), 3);
+  ASSERT_GT(loaded.get_tree().verify(), 0);
+  long expected[] = {1, 3, 5};
+  int i = 0;
+  for (long k : loaded) ASSERT_EQ(k, expected[i++]);
+
+  // the free slot left by 9 survives the round trip and is reused
+  loaded.insert(7);
+  ASSERT_EQ(loaded.get_tree().arena_size(), 4u);
+
+  std::stringstream bad("garbage");
+  ASSERT_THROW(loaded.read(bad), std::runtime_error);
+}
+
+TEST(TestCompactTree, corrupt_header) {
+  s21::compact_set<long> s{5, 1, 9, 3};
+  s.erase(9);
+  std::stringstream buf;
+  s.write(buf);
+  const std::string good = buf.str();
+
+  // patches a field of the header and tries to load the result
+  auto load_patched = [&good](std::size_t offset, auto value) {
+    std::string bytes = good;
+    std::memcpy(&bytes[offset], &value, sizeof(value));
+    std::stringstream in(bytes);
+    s21::compact_set<long> loaded{42};
+    EXPECT_THROW(loaded.read(in), std::runtime_error) << offset;
+    // a failed read leaves the tree as it was
+    EXPECT_EQ(loaded.size(), 1u);
+    EXPECT_TRUE(loaded.contains(42));
+  };
+  load_patched(16, std::uint64_t(5));            // size > count
+  load_patched(24, std::uint64_t(0xffffffffu));  // count >= kNil
+  load_patched(32, std::uint32_t(4));            // root past the arena
+  load_patched(32, std::uint32_t(0xffffffffu));  // no root, size 3
+  load_patched(36, std::uint32_t(1000));         // free_head past the arena
+
+  std::stringstream in(good);
+  s21::compact_set<long> loaded;
+  loaded.read(in);
+  ASSERT_EQ(loaded.size(), 3u);
+}
+
+TEST(TestCompactTree, corrupt_node_links) {
+  typedef s21::compact_set<long>::tree_type tree_type;
+  typedef tree_type::node node;
+  s21::compact_set<long> s{5, 1, 9, 3};
+  std::stringstream buf;
+  s.write(buf);
+  const std::string good = buf.str();
+  const std::size_t nodes_at = good.size() - 4 * sizeof(node);
+
+  // points a link of node i past the arena and tries to load the result
+  auto load_patched = [&](std::size_t i, std::size_t link) {
+    std::string bytes = good;
+    const std::uint32_t bad = 4;
+    std::memcpy(&bytes[nodes_at + i * sizeof(node) + link], &bad, sizeof(bad));
+    std::stringstream in(bytes);
+    s21::compact_set<long> loaded{42};
+    EXPECT_THROW(loaded.read(in), std::runtime_error) << i << ' ' << link;
+    EXPECT_EQ(loaded.size(), 1u);
+  };
+  for (std::size_t i = 0; i < 4; ++i) {
+    load_patched(i, offsetof(node, left));
+    load_patched(i, offsetof(node, right));
+    load_patched(i, offsetof(node, parent));
+  }
+}
+
+TEST(TestCompactTree, cyclic_links_and_bad_free_list) {
+  typedef s21::compact_set<long>::tree_type tree_type;
+  typedef tree_type::node node;
+  s21::compact_set<long> s{5, 1, 9, 3, 7};
+  s.erase(9);
+  std::stringstream buf;
+  s.write(buf);
+  const std::string good = buf.str();
+  const std::size_t nodes_at = good.size() - 5 * sizeof(node);
+  std::uint32_t root, free_head;
+  std::memcpy(&root, &good[32], sizeof(root));
+  std::memcpy(&free_head, &good[36], sizeof(free_head));
+
+  // sets a link of node i to value and tries to load the result
+  auto load_patched = [&](std::uint32_t i, std::size_t link,
+                          std::uint32_t value) {
+    std::string bytes = good;
+    std::memcpy(&bytes[nodes_at + i * sizeof(node) + link], &value,
+                sizeof(value));
+    std::stringstream in(bytes);
+    s21::compact_set<long> loaded{42};
+    EXPECT_THROW(loaded.read(in), std::runtime_error) << i << ' ' << link;
+    EXPECT_EQ(loaded.size(), 1u);
+  };
+  load_patched(root, offsetof(node, right), root);  // root is its own child
+  load_patched(root, offsetof(node, parent), root);
+  // the free list runs into a live node, or loops on its only slot
+  load_patched(free_head, offsetof(node, left), root);
+  load_patched(free_head, offsetof(node, left), free_head);
+}
+
+TEST(TestCompactTree, corrupt_key_order) {
+  typedef s21::compact_set<long>::tree_type tree_type;
+  typedef tree_type::node node;
+  // 5 is the root, 3 the right child of its left child 1
+  s21::compact_set<long> s{5, 1, 9, 3};
+  std::stringstream buf;
+  s.write(buf);
+  std::string bytes = buf.str();
+  const std::size_t nodes_at = bytes.size() - 4 * sizeof(node);
+  for (std::size_t i = 0; i < 4; ++i) {
+    long key;
+    std::memcpy(&key, &bytes[nodes_at + i * sizeof(node) + offsetof(node, key)],
+                sizeof(key));
+    if (key != 3) continue;
+    // 7 is still greater than its parent 1, but not less than the root
+    key = 7;
+    std::memcpy(&bytes[nodes_at + i * sizeof(node) + offsetof(node, key)], &key,
+                sizeof(key));
+  }
+  std::stringstream in(bytes);
+  s21::compact_set<long> loaded{42};
+  ASSERT_THROW(loaded.read(in), std::runtime_error);
+  ASSERT_EQ(loaded.size(), 1u);
+}
@@ -0,0 +1,129 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../containers_plus/concurrent_skiplist_map.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+// copying throws while armed
+struct fragile {
+  inline static bool armed = false;
+
+  fragile(int x) : v{x} {}
+  fragile(const fragile& other) : v{other.v} {
+    if (armed) throw std::runtime_error("copy");
+  }
+
+  bool operator<(const fragile& other) const { return v < other.v; }
+
+  int v;
+};
+
+}  // namespace
+
+TEST(TestConcurrentSkiplistMap, single_thread) {
+  s21::concurrent_skiplist_map<int, std::string> m{{3, "c"}, {1, "a"}};
+  ASSERT_TRUE(m.insert(2, "b").second);
+  ASSERT_FALSE(m.insert({2, "x"}).second);
+  ASSERT_EQ(m.at(2), "b");
+  ASSERT_FALSE(m.insert_or_assign(2, "bb").second);
+  ASSERT_EQ(m.find(2).value(), "bb");
+  ASSERT_THROW(m.at(4), std::out_of_range);
+  ASSERT_EQ(m.size(), 3);
+
+  int keys[] = {1, 2, 3};
+  int i = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) ASSERT_EQ(*it, keys[i++]);
+
+  ASSERT_EQ(*m.lower_bound(2), 2);
+  ASSERT_EQ(*m.upper_bound(2), 3);
+  ASSERT_EQ(m.upper_bound(3), m.end());
+
+  ASSERT_EQ(m.erase(2), 1);
+  ASSERT_EQ(m.erase(2), 0);
+  ASSERT_FALSE(m.contains(2));
+  ASSERT_EQ(m.count(3), 1);
+  ASSERT_EQ(*m.lower_bound(2), 3);
+}
+
+TEST(TestConcurrentSkiplistMap, throwing_copy_leaves_no_node) {
+  s21::concurrent_skiplist_map<fragile, int> by_key;
+  s21::concurrent_skiplist_map<int, fragile> by_value;
+  by_key.insert(fragile(1), 1);
+  by_value.insert(1, fragile(1));
+
+  fragile::armed = true;
+  ASSERT_THROW(by_key.insert(fragile(2), 2), std::runtime_error);
+  ASSERT_THROW(by_value.insert(2, fragile(2)), std::runtime_error);
+  fragile::armed = false;
+
+  ASSERT_EQ(by_key.size(), 1);
+  ASSERT_EQ(by_value.size(), 1);
+  ASSERT_FALSE(by_key.contains(fragile(2)));
+  ASSERT_FALSE(by_value.contains(2));
+  ASSERT_TRUE(by_key.insert(fragile(2), 2).second);
+  ASSERT_TRUE(by_value.insert(2, fragile(2)).second);
+}
+
+TEST(TestConcurrentSkiplistMap, random_against_std) {
+  s21::concurrent_skiplist_map<int, int> m;
+  std::map<int, int> ref;
+  std::mt19937 gen(35);
+  for (int i = 0; i < 20000; ++i) {
+    int k = gen() % 2000;
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(m.erase(k), ref.erase(k));
+    } else {
+      m.insert_or_assign(k, i);
+      ref[k] = i;
+    }
+  }
+  ASSERT_EQ(m.size(), ref.size());
+
+  std::vector<std::pair<int, int>> got;
+  m.scan(500, 1500, [&](int k, int v) { got.emplace_back(k, v); });
+  std::vector<std::pair<int, int>> want(ref.lower_bound(500),
+                                        ref.lower_bound(1500));
+  ASSERT_EQ(got, want);
+}
+
+TEST(TestConcurrentSkiplistMap, parallel_insert_erase_scan) {
+  const int kThreads = 4, kKeys = 3000;
+  s21::concurrent_skiplist_map<int, int> m;
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < kThreads; ++t) {
+    pool.emplace_back([&, t] {
+      // every thread inserts all even keys, odd keys are inserted and
+      // erased again by their owner, everybody checks the order of a scan
+      for (int k = 0; k < kKeys; ++k) {
+        if (k % 2 == 0) {
+          m.insert(k, k);
+        } else if (k % kThreads == t) {
+          m.insert(k, k);
+          ASSERT_EQ(m.erase(k), 1);
+        }
+        if (k % 500 == 0) {
+          int prev = -1;
+          m.scan(0, kKeys, [&](int key, int value) {
+            ASSERT_LT(prev, key);
+            ASSERT_EQ(key, value);
+            prev = key;
+          });
+        }
+      }
+    });
+  }
+  for (std::thread& th : pool) th.join();
+
+  ASSERT_EQ(m.size(), static_cast<std::size_t>(kKeys / 2));
+  int expected = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, expected += 2)
+    ASSERT_EQ(*it, expected);
+  ASSERT_EQ(expected, kKeys);
+}
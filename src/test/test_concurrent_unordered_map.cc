@@ -0,0 +1,69 @@
+#include <atomic>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../containers_plus/concurrent_unordered_map.h"
+#include "gtest/gtest.h"
+
+TEST(TestConcurrentUnorderedMap, single_thread) {
+  s21::concurrent_unordered_map<std::string, int> m(5);
+  ASSERT_EQ(m.shard_count(), 8);
+  ASSERT_TRUE(m.insert("a", 1));
+  ASSERT_FALSE(m.insert("a", 2));
+  ASSERT_EQ(*m.find("a"), 1);
+  ASSERT_FALSE(m.insert_or_assign("a", 3));
+  ASSERT_EQ(*m.find("a"), 3);
+  ASSERT_FALSE(m.find("b").has_value());
+
+  ASSERT_TRUE(m.update("a", [](int& v) { v *= 2; }));
+  ASSERT_FALSE(m.update("b", [](int& v) { v *= 2; }));
+  ASSERT_EQ(*m.find("a"), 6);
+
+  ASSERT_EQ(m.compute_if_absent("b", [] { return 7; }), 7);
+  ASSERT_EQ(m.compute_if_absent("b", [] { return 8; }), 7);
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_EQ(m.erase("a"), 1);
+  ASSERT_FALSE(m.contains("a"));
+  m.clear();
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(TestConcurrentUnorderedMap, parallel_writers_and_readers) {
+  const int kThreads = 8, kKeys = 4000;
+  s21::concurrent_unordered_map<int, int> m;
+  m.reserve(2 * kKeys);
+  // keys [kKeys, 2 * kKeys) are live at the start and every thread races
+  // to erase each of them while the others write and read
+  for (int k = kKeys; k < 2 * kKeys; ++k) m.insert(k, -1);
+  std::atomic<int> computed{0}, erased{0}, failures{0};
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < kThreads; ++t) {
+    pool.emplace_back([&] {
+      for (int k = 0; k < kKeys; ++k) {
+        m.compute_if_absent(k, [&] {
+          ++computed;
+          return k * 2;
+        });
+        m.update(k, [](int& v) { v += 1; });
+        erased += static_cast<int>(m.erase(k + kKeys));
+        std::optional<int> v = m.find(k);
+        if (!v.has_value() || *v <= k * 2) ++failures;
+        v = m.find(k + kKeys);
+        if (v.has_value() && *v != -1) ++failures;
+      }
+    });
+  }
+  for (std::thread& th : pool) th.join();
+
+  ASSERT_EQ(failures.load(), 0);
+  ASSERT_EQ(computed.load(), kKeys);
+  ASSERT_EQ(erased.load(), kKeys);
+  ASSERT_EQ(m.size(), static_cast<std::size_t>(kKeys));
+  for (int k = 0; k < kKeys; ++k) {
+    ASSERT_EQ(*m.find(k), k * 2 + kThreads);
+    ASSERT_FALSE(m.contains(k + kKeys));
+  }
+}
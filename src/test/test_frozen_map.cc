@@ -0,0 +1,39 @@
+#include <map>
+
+#include "../containers_plus/frozen_map.h"
+#include "gtest/gtest.h"
+
+TEST(TestFrozenMap, at_and_find) {
+  s21::map<int, std::string> m;
+  std::map<int, std::string> orig;
+  for (int i = 0; i < 500; ++i) {
+    m.insert(std::make_pair(i * 3, std::to_string(i)));
+    orig.insert(std::make_pair(i * 3, std::to_string(i)));
+  }
+  s21::frozen_map<int, std::string> f(m);
+
+  ASSERT_EQ(f.size(), orig.size());
+  for (int k = -3; k < 1503; ++k) {
+    if (orig.count(k)) {
+      ASSERT_EQ(f.at(k), orig[k]);
+      ASSERT_EQ(f.find(k).value(), orig[k]);
+    } else {
+      ASSERT_THROW(f.at(k), std::out_of_range);
+      ASSERT_TRUE(f.find(k) == f.end());
+    }
+  }
+}
+
+TEST(TestFrozenMap, iteration) {
+  s21::map<int, int> m{{5, 50}, {1, 10}, {3, 30}, {4, 40}, {2, 20}};
+  s21::frozen_map<int, int> f(m);
+
+  int expected = 1;
+  for (auto it = f.begin(); it != f.end(); ++it, ++expected) {
+    ASSERT_EQ(it.key(), expected);
+    ASSERT_EQ(it.value(), expected * 10);
+  }
+  ASSERT_EQ(expected, 6);
+  ASSERT_EQ(f.lower_bound(3).value(), 30);
+  ASSERT_EQ(*f.upper_bound(3), 4);
+}
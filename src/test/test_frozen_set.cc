@@ -0,0 +1,73 @@
+#include <set>
+
+#include "../containers_plus/frozen_set.h"
+#include "gtest/gtest.h"
+
+TEST(TestFrozenSet, empty) {
+  s21::set<int> s;
+  s21::frozen_set<int> f(s);
+  ASSERT_TRUE(f.empty());
+  ASSERT_EQ(f.size(), 0);
+  ASSERT_TRUE(f.begin() == f.end());
+  ASSERT_TRUE(f.find(1) == f.end());
+  ASSERT_TRUE(f.lower_bound(1) == f.end());
+}
+
+TEST(TestFrozenSet, find_every_size) {
+  // cover complete and incomplete bottom levels of the implicit tree
+  for (int n = 1; n < 70; ++n) {
+    s21::set<int> s;
+    for (int i = 0; i < n; ++i) s.insert(i * 2);
+    s21::frozen_set<int> f(s);
+    ASSERT_EQ(f.size(), static_cast<std::size_t>(n));
+    for (int k = -1; k <= 2 * n; ++k) {
+      if (k >= 0 && k % 2 == 0 && k < 2 * n) {
+        ASSERT_TRUE(f.contains(k));
+        ASSERT_EQ(*f.find(k), k);
+      } else {
+        ASSERT_FALSE(f.contains(k));
+        ASSERT_TRUE(f.find(k) == f.end());
+      }
+    }
+  }
+}
+
+TEST(TestFrozenSet, bounds) {
+  std::set<int> orig;
+  s21::set<int> s;
+  for (int i = 0; i < 1000; ++i) {
+    int v = (i * 7919) % 3001;
+    orig.insert(v);
+    s.insert(v);
+  }
+  s21::frozen_set<int> f(s);
+
+  for (int k = -2; k < 3003; ++k) {
+    auto lb = orig.lower_bound(k);
+    auto ub = orig.upper_bound(k);
+    if (lb == orig.end())
+      ASSERT_TRUE(f.lower_bound(k) == f.end());
+    else
+      ASSERT_EQ(*f.lower_bound(k), *lb);
+    if (ub == orig.end())
+      ASSERT_TRUE(f.upper_bound(k) == f.end());
+    else
+      ASSERT_EQ(*f.upper_bound(k), *ub);
+  }
+}
+
+TEST(TestFrozenSet, iteration) {
+  s21::set<std::string> s{"pear", "apple", "fig", "kiwi", "banana"};
+  std::set<std::string> orig{"pear", "apple", "fig", "kiwi", "banana"};
+  s21::frozen_set<std::string> f(s);
+
+  auto it = f.begin();
+  for (const auto& v : orig) ASSERT_EQ(*it++, v);
+  ASSERT_TRUE(it == f.end());
+
+  auto rit = orig.rbegin();
+  for (auto i = --f.end();; --i) {
+    ASSERT_EQ(*i, *rit++);
+    if (i == f.begin()) break;
+  }
+}
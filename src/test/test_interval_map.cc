@@ -0,0 +1,96 @@
+#include <random>
+#include <set>
+
+#include "../containers_plus/interval_map.h"
+#include "gtest/gtest.h"
+
+typedef std::pair<int, int> interval;
+
+TEST(TestIntervalMap, insert_and_at) {
+  s21::interval_map<int, std::string> m;
+  ASSERT_TRUE(m.insert(10, 20, "a").second);
+  ASSERT_TRUE(m.insert(10, 15, "b").second);
+  ASSERT_FALSE(m.insert(10, 20, "c").second);
+  ASSERT_THROW(m.insert(5, 5, "d"), std::invalid_argument);
+
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_EQ(m.at(10, 20), "a");
+  ASSERT_EQ(*m.begin(), interval(10, 15));
+  ASSERT_EQ(m.erase(10, 15), 1);
+  ASSERT_THROW(m.at(10, 15), std::out_of_range);
+}
+
+TEST(TestIntervalMap, overlapping) {
+  s21::interval_map<int, int> m;
+  m.insert(0, 10, 1);
+  m.insert(5, 8, 2);
+  m.insert(10, 12, 3);
+  m.insert(20, 30, 4);
+
+  auto res = m.overlapping(8, 11);
+  ASSERT_EQ(res.size(), 2);
+  ASSERT_EQ(*res[0], interval(0, 10));
+  ASSERT_EQ(*res[1], interval(10, 12));
+  ASSERT_EQ(res[1].get_ptr()->value, 3);
+
+  ASSERT_EQ(m.overlapping(12, 20).size(), 0);
+  ASSERT_EQ(m.overlapping(7, 7).size(), 0);
+
+  auto stab = m.stabbing(5);
+  ASSERT_EQ(stab.size(), 2);
+  ASSERT_EQ(*stab[0], interval(0, 10));
+  ASSERT_EQ(*stab[1], interval(5, 8));
+  ASSERT_EQ(m.stabbing(10).size(), 1);
+  ASSERT_EQ(m.stabbing(30).size(), 0);
+}
+
+TEST(TestIntervalMap, const_access) {
+  s21::interval_map<int, int> m;
+  m.insert(0, 10, 1);
+  m.insert(5, 8, 2);
+  const s21::interval_map<int, int>& c = m;
+
+  ASSERT_EQ(c.at(5, 8), 2);
+  ASSERT_THROW(c.at(5, 9), std::out_of_range);
+  ASSERT_EQ(*c.find(0, 10), interval(0, 10));
+  ASSERT_EQ(c.find(1, 2), c.end());
+
+  s21::vector<decltype(m)::const_iterator> res = c.overlapping(6, 7);
+  ASSERT_EQ(res.size(), 2);
+  ASSERT_EQ(*res[1], interval(5, 8));
+  ASSERT_EQ(c.stabbing(9).size(), 1);
+}
+
+TEST(TestIntervalMap, random_against_scan) {
+  s21::interval_map<int, int> m;
+  std::set<interval> orig;
+  std::mt19937 gen(11);
+
+  for (int i = 0; i < 2000; ++i) {
+    int lo = gen() % 1000, hi = lo + 1 + gen() % 50;
+    auto victim = orig.lower_bound(interval(lo, 0));
+    if (gen() % 4 == 0 && victim != orig.end()) {
+      ASSERT_EQ(m.erase(victim->first, victim->second), 1);
+      orig.erase(victim);
+    } else {
+      m.insert(lo, hi, i);
+      orig.insert(interval(lo, hi));
+    }
+
+    int qlo = gen() % 1000, qhi = qlo + gen() % 30;
+    std::vector<interval> want, stab_want;
+    for (const auto& iv : orig) {
+      if (iv.first < qhi && qlo < iv.second && qlo < qhi) want.push_back(iv);
+      if (iv.first <= qlo && qlo < iv.second) stab_want.push_back(iv);
+    }
+
+    auto got = m.overlapping(qlo, qhi);
+    ASSERT_EQ(got.size(), want.size());
+    for (std::size_t j = 0; j < want.size(); ++j) ASSERT_EQ(*got[j], want[j]);
+
+    auto stab = m.stabbing(qlo);
+    ASSERT_EQ(stab.size(), stab_want.size());
+    for (std::size_t j = 0; j < stab_want.size(); ++j)
+      ASSERT_EQ(*stab[j], stab_want[j]);
+  }
+}
@@ -535,6 +535,40 @@ TEST(method, splice_2) {
   }
 }
 
+TEST(method, splice_element) {
+  s21::list<int> l1{1, 2, 3};
+  s21::list<int> l2{10, 20, 30};
+  std::list<int> test1{1, 2, 3};
+  std::list<int> test2{10, 20, 30};
+
+  l1.splice(++l1.cbegin(), l2, ++l2.cbegin());
+  test1.splice(++test1.cbegin(), test2, ++test2.cbegin());
+  EXPECT_EQ(l1.size(), test1.size());
+  EXPECT_EQ(l2.size(), test2.size());
+
+  // same list: move the last element to the front and the first to the end
+  s21::list<int>::const_iterator last = l1.cbegin();
+  for (std::size_t i = 1; i < l1.size(); ++i) ++last;
+  l1.splice(l1.cbegin(), l1, last);
+  test1.splice(test1.cbegin(), test1, --test1.cend());
+  l1.splice(l1.cend(), l1, l1.cbegin());
+  test1.splice(test1.cend(), test1, test1.cbegin());
+  l1.splice(l1.cbegin(), l1, l1.cbegin());
+
+  s21::list<int>::iterator j = l1.begin();
+  for (auto i : test1) {
+    EXPECT_EQ(*j, i);
+    ++j;
+  }
+  j = l2.begin();
+  for (auto i : test2) {
+    EXPECT_EQ(*j, i);
+    ++j;
+  }
+  EXPECT_EQ(l1.back(), test1.back());
+  EXPECT_EQ(l2.back(), test2.back());
+}
+
 TEST(method, reverse_1) {
   s21::list<int> l1{1, 2, 3, 5, 6, 10};
   std::list<int> test1{10, 6, 5, 3, 2, 1};
@@ -663,3 +697,63 @@ TEST_F(ListTest, remove) {
   ASSERT_EQ(lst.front(), 2);
   ASSERT_EQ(lst.back(), 8);
 }
+
+namespace {
+
+int list_allocations = 0;
+
+template <class T>
+struct counting_allocator {
+  typedef T value_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::size_t size_type;
+  template <class U>
+  struct rebind {
+    typedef counting_allocator<U> other;
+  };
+
+  counting_allocator() = default;
+  template <class U>
+  counting_allocator(const counting_allocator<U> &) {}
+
+  T *allocate(std::size_t n) {
+    ++list_allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  bool operator==(const counting_allocator &) const { return true; }
+  bool operator!=(const counting_allocator &) const { return false; }
+};
+
+}  // namespace
+
+TEST(method, assign_reuses_nodes) {
+  typedef s21::list<std::string, counting_allocator<std::string>> list;
+  list a{"a", "b", "c", "d"};
+  list b{"w", "x", "y", "z"};
+
+  list_allocations = 0;
+  b = a;
+  ASSERT_EQ(list_allocations, 0);
+  ASSERT_EQ(b.size(), 4);
+  ASSERT_EQ(b.front(), "a");
+  ASSERT_EQ(b.back(), "d");
+
+  b.assign(2, "q");
+  b.assign({"1", "2", "3"});
+  ASSERT_EQ(list_allocations, 1);
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b.back(), "3");
+
+  list_allocations = 0;
+  b = {"only"};
+  ASSERT_EQ(list_allocations, 0);
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_EQ(b.front(), "only");
+  ASSERT_EQ(b.back(), "only");
+}
@@ -0,0 +1,139 @@
+#include <stdexcept>
+#include <string>
+
+#include "../containers_plus/lru_cache.h"
+#include "gtest/gtest.h"
+
+TEST(TestLruCache, get_put_evict) {
+  s21::lru_cache<int, std::string> c(3);
+  c.put(1, "one");
+  c.put(2, "two");
+  c.put(3, "three");
+  ASSERT_EQ(c.size(), 3);
+
+  ASSERT_EQ(*c.get(1), "one");  // 1 is now the most recent
+  c.put(4, "four");             // evicts 2
+  ASSERT_FALSE(c.contains(2));
+  ASSERT_EQ(c.get(2), nullptr);
+  ASSERT_TRUE(c.contains(1));
+
+  ASSERT_EQ(c.hits(), 1);
+  ASSERT_EQ(c.misses(), 1);
+  c.reset_stats();
+  ASSERT_EQ(c.hits(), 0);
+
+  int order[] = {4, 1, 3};
+  int i = 0;
+  for (auto it = c.begin(); it != c.end(); ++it)
+    ASSERT_EQ((*it).first, order[i++]);
+}
+
+TEST(TestLruCache, touch_and_overwrite) {
+  s21::lru_cache<int, int> c(2);
+  c.put(1, 10);
+  c.put(2, 20);
+  ASSERT_TRUE(c.touch(1));
+  ASSERT_FALSE(c.touch(5));
+  c.put(3, 30);  // evicts 2
+  ASSERT_FALSE(c.contains(2));
+
+  c.put(1, 11);
+  ASSERT_EQ(c.size(), 2);
+  ASSERT_EQ(*c.get(1), 11);
+  ASSERT_EQ(c.erase(1), 1);
+  ASSERT_EQ(c.erase(1), 0);
+  ASSERT_EQ(c.size(), 1);
+  ASSERT_EQ((*c.begin()).first, 3);
+}
+
+struct StringBytes {
+  std::size_t operator()(int, const std::string& s) const { return s.size(); }
+};
+
+TEST(TestLruCache, weight_budget) {
+  s21::lru_cache<int, std::string, StringBytes> c(100, 10);
+  c.put(1, "aaaa");
+  c.put(2, "bbbb");
+  ASSERT_EQ(c.weight(), 8);
+  c.put(3, "cccc");  // 12 > 10, evicts 1
+  ASSERT_EQ(c.weight(), 8);
+  ASSERT_FALSE(c.contains(1));
+
+  c.put(2, "b");
+  ASSERT_EQ(c.weight(), 5);
+
+  c.put(4, std::string(20, 'x'));  // over budget alone, kept
+  ASSERT_EQ(c.size(), 1);
+  ASSERT_TRUE(c.contains(4));
+
+  c.clear();
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.weight(), 0);
+}
+
+TEST(TestLruCache, zero_capacity) {
+  ASSERT_THROW((s21::lru_cache<int, int>(0)), std::invalid_argument);
+}
+
+TEST(TestLruCache, copy) {
+  s21::lru_cache<int, std::string> c(3);
+  c.put(1, "one");
+  c.put(2, "two");
+  s21::lru_cache<int, std::string> d(c);
+  ASSERT_EQ(d.erase(1), 1);
+  ASSERT_TRUE(c.contains(1));
+  d.put(3, "three");
+  d.put(4, "four");
+  ASSERT_EQ(*d.get(2), "two");
+  ASSERT_EQ(d.size(), 3);
+  ASSERT_EQ(c.size(), 2);
+
+  c = d;
+  c.put(5, "five");  // evicts 3 in c only
+  ASSERT_FALSE(c.contains(3));
+  ASSERT_TRUE(d.contains(3));
+  ASSERT_EQ(*c.get(2), "two");
+
+  s21::lru_cache<int, std::string> e(std::move(c));
+  ASSERT_EQ(e.erase(5), 1);
+  ASSERT_EQ(e.size(), 2);
+}
+
+namespace {
+
+// a value whose copies throw while armed
+struct Fragile {
+  static bool armed;
+  std::size_t weight;
+  explicit Fragile(std::size_t w) : weight{w} {}
+  Fragile(const Fragile& other) : weight{other.weight} {
+    if (armed) throw std::runtime_error("copy");
+  }
+  Fragile& operator=(const Fragile& other) {
+    if (armed) throw std::runtime_error("assign");
+    weight = other.weight;
+    return *this;
+  }
+};
+
+bool Fragile::armed = false;
+
+struct FragileWeight {
+  std::size_t operator()(int, const Fragile& f) const { return f.weight; }
+};
+
+}  // namespace
+
+TEST(TestLruCache, failed_put_keeps_weight) {
+  s21::lru_cache<int, Fragile, FragileWeight> c(10);
+  c.put(1, Fragile(3));
+  c.put(2, Fragile(4));
+  Fragile::armed = true;
+  ASSERT_THROW(c.put(1, Fragile(100)), std::runtime_error);  // overwrite
+  ASSERT_THROW(c.put(3, Fragile(100)), std::runtime_error);  // insert
+  Fragile::armed = false;
+  ASSERT_EQ(c.weight(), 7);
+  ASSERT_EQ(c.size(), 2);
+  ASSERT_EQ(c.get(1)->weight, 3);
+  ASSERT_FALSE(c.contains(3));
+}
@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <random>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../containers/map.h"
@@ -278,3 +281,116 @@ TEST_F(TestMap, erase) {
   EXPECT_EQ(A.size(), 0);
   EXPECT_EQ(A.size(), B.size());
 }
+
+TEST(TestMapBalance, avl) {
+  s21::map<int, std::string, std::less<int>, AVLBalance> m;
+  std::map<int, std::string> orig;
+  for (int i = 0; i < 100; ++i) {
+    m.insert(std::make_pair(i * 7 % 100, std::to_string(i)));
+    orig.insert(std::make_pair(i * 7 % 100, std::to_string(i)));
+  }
+  for (int i = 0; i < 100; i += 3) {
+    m.erase(i);
+    orig.erase(i);
+  }
+
+  ASSERT_EQ(m.size(), orig.size());
+  for (const auto& p : orig) ASSERT_EQ(m.at(p.first), p.second);
+}
+
+template <class M, class = void>
+struct has_subscript : std::false_type {};
+
+template <class M>
+struct has_subscript<M, std::void_t<decltype(std::declval<M&>()[0])>>
+    : std::true_type {};
+
+TEST(TestMapAugment, values_read_only) {
+  typedef s21::map<int, long, std::less<int>, RBBalance, SumAugment<long>>
+      sum_map;
+  static_assert(!has_subscript<sum_map>::value);
+  static_assert(has_subscript<s21::map<int, long>>::value);
+  static_assert(std::is_same_v<decltype(std::declval<sum_map&>().at(0)),
+                               const long&>);
+
+  sum_map m;
+  m.insert_or_assign(1, 5);
+  m.insert_or_assign(2, 7);
+  ASSERT_EQ(m.at(2), 7);
+  m.insert_or_assign(2, 1);
+  ASSERT_EQ(m.aggregate(0, 3), 6);
+}
+
+TEST(TestMapTreap, split_join) {
+  s21::map<int, int, std::less<int>, TreapBalance> m;
+  for (int i = 0; i < 100; ++i) m.insert({i, i * i});
+  auto upper = m.split(60);
+  ASSERT_EQ(m.size(), 60);
+  ASSERT_EQ(upper.size(), 40);
+  ASSERT_EQ(upper.at(60), 3600);
+  ASSERT_EQ(m.find(60), m.end());
+  m.join(upper);
+  ASSERT_EQ(m.size(), 100);
+  ASSERT_EQ(m.at(99), 99 * 99);
+
+  // the filters of both halves follow their keys
+  s21::map<int, int, std::less<int>, TreapBalance, void, BloomFilter<int>> f;
+  for (int i = 0; i < 100; ++i) f.insert({i, i});
+  auto high = f.split(50);
+  ASSERT_EQ(high.at(75), 75);
+  ASSERT_EQ(f.at(25), 25);
+  ASSERT_EQ(f.find(75), f.end());
+  f.join(high);
+  ASSERT_EQ(f.at(75), 75);
+}
+
+TEST(TestMapAugment, sum_and_min) {
+  s21::map<int, long, std::less<int>, RBBalance, SumAugment<long>> sums;
+  s21::map<int, int, std::less<int>, AVLBalance, MinAugment<int>> mins;
+  std::map<int, int> orig;
+  std::mt19937 gen(7);
+
+  auto check = [&]() {
+    for (int i = 0; i < 50; ++i) {
+      int lo = gen() % 220 - 10, hi = gen() % 220 - 10;
+      long sum = 0;
+      int mn = std::numeric_limits<int>::max();
+      for (auto it = orig.lower_bound(lo); it != orig.end() && it->first < hi;
+           ++it) {
+        sum += it->second;
+        mn = std::min(mn, it->second);
+      }
+      ASSERT_EQ(sums.aggregate(lo, hi), sum);
+      ASSERT_EQ(mins.aggregate(lo, hi), mn);
+    }
+  };
+
+  for (int i = 0; i < 300; ++i) {
+    int k = gen() % 200, v = gen() % 1000 - 500;
+    sums.insert_or_assign(k, v);
+    mins.insert_or_assign(k, v);
+    orig[k] = v;
+    if (i % 10 == 0) check();
+  }
+  for (int i = 0; i < 300; ++i) {
+    int k = gen() % 200;
+    sums.erase(k);
+    mins.erase(k);
+    orig.erase(k);
+    if (i % 10 == 0) check();
+  }
+  check();
+}
+
+TEST(TestMapFilter, bloom) {
+  s21::map<std::string, int, std::less<std::string>, RBBalance, void,
+           BloomFilter<std::string>>
+      m;
+  for (int i = 0; i < 1000; ++i) m.insert({std::to_string(i), i});
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(m.at(std::to_string(i)), i);
+  for (int i = 1000; i < 2000; ++i)
+    ASSERT_EQ(m.find(std::to_string(i)), m.end());
+  ASSERT_THROW(m.at("missing"), std::out_of_range);
+  ASSERT_EQ(m.erase("5"), 1);
+  ASSERT_EQ(m.erase("5"), 0);
+}
@@ -0,0 +1,146 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "../containers_plus/mapped_static_map.h"
+#include "gtest/gtest.h"
+
+class MappedStaticMapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path = "/tmp/s21_mapped_static_map_" + std::to_string(::getpid());
+  }
+
+  void TearDown() override { ::unlink(path.c_str()); }
+
+  std::string path;
+};
+
+TEST_F(MappedStaticMapTest, empty) {
+  s21::map<int, double> m;
+  s21::mapped_static_map<int, double>::write(path, m);
+
+  s21::mapped_static_map<int, double> sm(path);
+  ASSERT_TRUE(sm.is_open());
+  ASSERT_TRUE(sm.empty());
+  ASSERT_EQ(sm.size(), 0);
+  ASSERT_TRUE(sm.find(1) == sm.end());
+  ASSERT_TRUE(sm.lower_bound(1) == sm.end());
+  ASSERT_THROW(sm.at(1), std::out_of_range);
+}
+
+TEST_F(MappedStaticMapTest, find_and_at) {
+  s21::map<int, long> m;
+  std::map<int, long> orig;
+  for (int i = 0; i < 10000; ++i) {
+    m.insert(std::make_pair(i * 3, i * 7L));
+    orig.insert(std::make_pair(i * 3, i * 7L));
+  }
+  s21::mapped_static_map<int, long>::write(path, m);
+
+  s21::mapped_static_map<int, long> sm(path);
+  ASSERT_EQ(sm.size(), orig.size());
+  for (int k = -5; k < 30005; ++k) {
+    auto it = sm.find(k);
+    if (orig.count(k)) {
+      ASSERT_TRUE(it != sm.end());
+      ASSERT_EQ(it.key(), k);
+      ASSERT_EQ(it.value(), orig[k]);
+      ASSERT_EQ(sm.at(k), orig[k]);
+    } else {
+      ASSERT_TRUE(it == sm.end());
+      ASSERT_FALSE(sm.contains(k));
+    }
+  }
+}
+
+TEST_F(MappedStaticMapTest, bounds_and_range) {
+  s21::map<int, int> m{{10, 1}, {20, 2}, {30, 3}, {40, 4}, {50, 5}};
+  s21::mapped_static_map<int, int>::write(path, m);
+  s21::mapped_static_map<int, int> sm(path);
+
+  ASSERT_EQ(*sm.lower_bound(20), 20);
+  ASSERT_EQ(*sm.lower_bound(21), 30);
+  ASSERT_EQ(*sm.upper_bound(20), 30);
+  ASSERT_EQ(*sm.lower_bound(-100), 10);
+  ASSERT_TRUE(sm.upper_bound(50) == sm.end());
+
+  auto r = sm.range(15, 45);
+  int sum = 0;
+  for (auto it = r.first; it != r.second; ++it) sum += it.value();
+  ASSERT_EQ(sum, 2 + 3 + 4);
+  ASSERT_EQ(r.second - r.first, 3);
+}
+
+TEST_F(MappedStaticMapTest, iteration_order) {
+  s21::map<int, char> m;
+  for (int i = 999; i >= 0; --i) m.insert(std::make_pair(i, 'a' + i % 26));
+  s21::mapped_static_map<int, char>::write(path, m);
+  s21::mapped_static_map<int, char> sm(path);
+
+  int expected = 0;
+  for (auto it = sm.begin(); it != sm.end(); ++it, ++expected) {
+    ASSERT_EQ(*it, expected);
+    ASSERT_EQ(it.value(), 'a' + expected % 26);
+  }
+  ASSERT_EQ(expected, 1000);
+}
+
+TEST_F(MappedStaticMapTest, move) {
+  s21::map<int, int> m{{1, 1}, {2, 4}};
+  s21::mapped_static_map<int, int>::write(path, m);
+  s21::mapped_static_map<int, int> a(path);
+  s21::mapped_static_map<int, int> b(std::move(a));
+  ASSERT_FALSE(a.is_open());
+  ASSERT_EQ(b.at(2), 4);
+  a = std::move(b);
+  ASSERT_EQ(a.at(1), 1);
+  ASSERT_FALSE(b.is_open());
+}
+
+TEST_F(MappedStaticMapTest, bad_file) {
+  ASSERT_THROW((s21::mapped_static_map<int, int>("/nonexistent/s21/file")),
+               std::runtime_error);
+
+  s21::map<int, int> m{{1, 1}};
+  s21::mapped_static_map<int, int>::write(path, m);
+  ASSERT_THROW((s21::mapped_static_map<long, int>(path)), std::runtime_error);
+}
+
+TEST_F(MappedStaticMapTest, corrupt_header) {
+  s21::map<int, long> m;
+  for (int i = 0; i < 100; ++i) m.insert({i, i});
+  s21::mapped_static_map<int, long>::write(path, m);
+
+  // header fields: count at 8, keys_offset at 24, values_offset at 32
+  auto patch = [this](long offset, std::uint64_t value) {
+    std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+    f.seekp(offset);
+    f.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+  auto reopen_throws = [this] {
+    ASSERT_THROW((s21::mapped_static_map<int, long>(path)),
+                 std::runtime_error);
+  };
+
+  patch(8, 1000);  // sections past the end of the file
+  reopen_throws();
+  patch(8, ~std::uint64_t(0) / 2);  // count * sizeof overflows
+  reopen_throws();
+  patch(8, 100);
+  patch(24, 1 << 20);  // keys start past the end
+  reopen_throws();
+  patch(24, 128);  // keys run into the values
+  reopen_throws();
+  patch(24, 0);  // keys over the header
+  reopen_throws();
+  patch(24, 64);
+  patch(32, 516);  // values misaligned for long
+  reopen_throws();
+  patch(32, 512);
+  s21::mapped_static_map<int, long> ok(path);
+  ASSERT_EQ(ok.at(99), 99);
+}
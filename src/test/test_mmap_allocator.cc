@@ -0,0 +1,50 @@
+#include <cstdint>
+#include <string>
+
+#include "../containers/vector.h"
+#include "../containers_plus/mmap_allocator.h"
+#include "gtest/gtest.h"
+
+TEST(TestMmapAllocator, vector_grows_with_mremap) {
+  typedef s21::vector<std::uint64_t, s21::mmap_allocator<std::uint64_t>>
+      huge_vector;
+  static_assert(s21::vector_base<std::uint64_t,
+                                 s21::mmap_allocator<std::uint64_t>>::
+                    kUseRealloc);
+  huge_vector v;
+  const std::uint64_t n = 3 << 20;
+  for (std::uint64_t i = 0; i < n; ++i) v.push_back(i * 7);
+  v.insert(v.begin() + 1, 2, 0);
+  ASSERT_EQ(v.size(), n + 2);
+  ASSERT_EQ(v[0], 0);
+  ASSERT_EQ(v[3], 7);
+  ASSERT_EQ(v[4], 14);
+  ASSERT_EQ(v.back(), (n - 1) * 7);
+
+  // shrinking keeps the mapping where it is and unmaps the tail
+  v.resize(1000);
+  const std::uint64_t* data = v.data();
+  v.shrink_to_fit();
+  ASSERT_EQ(v.data(), data);
+  ASSERT_EQ(v.capacity(), 1000);
+  ASSERT_EQ(v[999], 997 * 7);
+
+  huge_vector copy = v;
+  ASSERT_TRUE(copy == v);
+  v.clear();
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 0);
+  ASSERT_EQ(v.data(), nullptr);
+}
+
+TEST(TestMmapAllocator, non_relocatable_type) {
+  static_assert(!s21::vector_base<std::string,
+                                  s21::mmap_allocator<std::string>>::
+                     kUseRealloc);
+  s21::vector<std::string, s21::mmap_allocator<std::string, false>> v;
+  for (int i = 0; i < 1000; ++i) v.push_back(std::to_string(i));
+  ASSERT_EQ(v[999], "999");
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) %
+                s21::mmap_allocator<int>::page_size(),
+            0);
+}
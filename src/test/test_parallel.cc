@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../containers/vector.h"
+#include "../containers_plus/array.h"
+#include "../containers_plus/parallel.h"
+#include "../containers_plus/thread_pool.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+const std::size_t kCount = 1 << 16;
+
+s21::vector<std::int64_t> random_values(std::size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  s21::vector<std::int64_t> v;
+  for (std::size_t i = 0; i < n; ++i) v.push_back(gen() % 100000);
+  return v;
+}
+
+class Parallel : public ::testing::TestWithParam<std::size_t> {
+ protected:
+  void SetUp() override {
+    s21::parallel::set_thread_count(GetParam());
+    s21::parallel::set_min_grain(1024);
+  }
+  void TearDown() override {
+    s21::parallel::set_thread_count(0);
+    s21::parallel::set_min_grain(1 << 12);
+  }
+};
+
+}  // namespace
+
+TEST(ThreadPool, runs_every_task) {
+  std::atomic<int> sum{0};
+  {
+    s21::thread_pool pool(3);
+    EXPECT_EQ(pool.size(), 3u);
+    for (int i = 1; i <= 1000; ++i) pool.submit([&sum, i] { sum += i; });
+  }
+  EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST(ThreadPool, caller_can_help) {
+  s21::thread_pool pool(0);
+  int ran = 0;
+  pool.submit([&ran] { ++ran; });
+  pool.submit([&ran] { ++ran; });
+  EXPECT_TRUE(pool.run_pending_task());
+  EXPECT_TRUE(pool.run_pending_task());
+  EXPECT_FALSE(pool.run_pending_task());
+  EXPECT_EQ(ran, 2);
+}
+
+TEST_P(Parallel, sort) {
+  s21::vector<std::int64_t> v = random_values(kCount + 17, 1);
+  std::vector<std::int64_t> want(v.begin(), v.end());
+  std::sort(want.begin(), want.end());
+  s21::parallel::sort(v.begin(), v.end());
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), want.begin()));
+
+  s21::parallel::sort(v.begin(), v.end(), std::greater<>());
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), want.rbegin()));
+}
+
+TEST_P(Parallel, sort_strings) {
+  s21::vector<std::string> v;
+  std::mt19937 gen(2);
+  for (std::size_t i = 0; i < 5000; ++i) v.push_back(std::to_string(gen()));
+  std::vector<std::string> want(v.begin(), v.end());
+  std::sort(want.begin(), want.end());
+  s21::parallel::sort(v.begin(), v.end());
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), want.begin()));
+}
+
+TEST_P(Parallel, for_each_and_transform) {
+  s21::vector<std::int64_t> v = random_values(kCount, 3);
+  s21::vector<std::int64_t> out(v.size());
+  auto end = s21::parallel::transform(v.begin(), v.end(), out.begin(),
+                                      [](std::int64_t x) { return x * 3; });
+  EXPECT_EQ(end, out.end());
+  s21::parallel::for_each(v.begin(), v.end(), [](std::int64_t& x) { x *= 3; });
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), out.begin()));
+}
+
+TEST_P(Parallel, copy) {
+  s21::vector<std::int64_t> v = random_values(kCount, 4);
+  s21::vector<std::int64_t> out(v.size() + 1, -1);
+  auto end = s21::parallel::copy(v.begin(), v.end(), out.begin());
+  EXPECT_EQ(end, out.begin() + v.size());
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), out.begin()));
+  EXPECT_EQ(out.back(), -1);
+}
+
+TEST_P(Parallel, reduce) {
+  s21::vector<std::int64_t> v = random_values(kCount, 5);
+  EXPECT_EQ(s21::parallel::reduce(v.begin(), v.end(), std::int64_t(7)),
+            std::accumulate(v.begin(), v.end(), std::int64_t(7)));
+  EXPECT_EQ(s21::parallel::reduce(v.begin(), v.begin(), std::int64_t(7)), 7);
+}
+
+TEST_P(Parallel, reduce_keeps_order) {
+  s21::vector<std::string> v;
+  for (std::size_t i = 0; i < 5000; ++i)
+    v.push_back(std::string(1, char('a' + i % 26)));
+  std::string want = std::accumulate(v.begin(), v.end(), std::string(">"));
+  EXPECT_EQ(s21::parallel::reduce(v.begin(), v.end(), std::string(">")), want);
+}
+
+TEST_P(Parallel, inclusive_scan) {
+  s21::vector<std::int64_t> v = random_values(kCount + 5, 6);
+  s21::vector<std::int64_t> got(v.size());
+  std::vector<std::int64_t> want(v.size());
+  std::partial_sum(v.begin(), v.end(), want.begin());
+  s21::parallel::inclusive_scan(v.begin(), v.end(), got.begin());
+  ASSERT_TRUE(std::equal(got.begin(), got.end(), want.begin()));
+
+  s21::vector<std::int64_t> ones(kCount, 1);
+  s21::parallel::inclusive_scan(ones.begin(), ones.end(), ones.begin(),
+                                [](std::int64_t a, std::int64_t b) {
+                                  return a + b;
+                                });
+  for (std::size_t i = 0; i < ones.size(); ++i)
+    ASSERT_EQ(ones[i], std::int64_t(i + 1));
+}
+
+TEST_P(Parallel, small_ranges) {
+  s21::vector<int> v = {3, 1, 2};
+  s21::parallel::sort(v.begin(), v.end());
+  EXPECT_EQ(v, (s21::vector<int>{1, 2, 3}));
+  s21::parallel::inclusive_scan(v.begin(), v.end(), v.begin());
+  EXPECT_EQ(v, (s21::vector<int>{1, 3, 6}));
+  s21::vector<int> empty;
+  s21::parallel::sort(empty.begin(), empty.end());
+  EXPECT_EQ(s21::parallel::reduce(empty.begin(), empty.end(), 5), 5);
+}
+
+TEST_P(Parallel, array) {
+  s21::array<int, 5000> a;
+  for (std::size_t i = 0; i < a.size(); ++i) a[i] = int(a.size() - i);
+  s21::parallel::sort(a.begin(), a.end());
+  EXPECT_TRUE(std::is_sorted(a.data(), a.data() + a.size()));
+  EXPECT_EQ(s21::parallel::reduce(a.begin(), a.end(), 0), 5000 * 5001 / 2);
+}
+
+TEST_P(Parallel, rethrows) {
+  s21::vector<int> v(kCount, 0);
+  v[kCount - 10] = 1;
+  EXPECT_THROW(s21::parallel::for_each(v.begin(), v.end(),
+                                       [](int x) {
+                                         if (x == 1)
+                                           throw std::runtime_error("x");
+                                       }),
+               std::runtime_error);
+}
+
+TEST_P(Parallel, nested) {
+  s21::vector<s21::vector<int>> rows(8, s21::vector<int>(kCount / 8, 1));
+  std::atomic<long> total{0};
+  s21::parallel::set_min_grain(1);
+  s21::parallel::for_each(rows.begin(), rows.end(), [&](s21::vector<int>& r) {
+    total += s21::parallel::reduce(r.begin(), r.end(), 0L);
+  });
+  EXPECT_EQ(total.load(), long(kCount));
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, Parallel, ::testing::Values(1, 2, 4));
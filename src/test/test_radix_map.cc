@@ -0,0 +1,221 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../containers_plus/radix_map.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+std::string random_url(std::mt19937& gen) {
+  static const char* hosts[] = {"https://example.com/", "https://example.org/",
+                                "http://a.b/", ""};
+  std::string s = hosts[gen() % 4];
+  int parts = gen() % 4;
+  for (int i = 0; i < parts; ++i) {
+    s += static_cast<char>('a' + gen() % 3);
+    if (gen() % 2) s += '/';
+  }
+  return s;
+}
+
+// Copying throws once the shared budget runs out
+struct Budgeted {
+  static int copies_left;
+  Budgeted() = default;
+  Budgeted(const Budgeted&) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+};
+int Budgeted::copies_left = -1;
+
+}  // namespace
+
+TEST(TestRadixMap, strings_with_shared_prefixes) {
+  s21::radix_map<std::string, int> m{{"romane", 1}, {"romanus", 2},
+                                     {"romulus", 3}, {"rubens", 4},
+                                     {"ruber", 5},   {"rubicon", 6}};
+  ASSERT_TRUE(m.insert({"rom", 7}).second);  // a key ending inside a prefix
+  ASSERT_TRUE(m.insert({"", 0}).second);
+  ASSERT_FALSE(m.insert({"rom", 8}).second);
+  ASSERT_EQ(m.size(), 8);
+  ASSERT_EQ(m.at("rom"), 7);
+  ASSERT_EQ(m.at("romanus"), 2);
+  ASSERT_EQ(m.at(""), 0);
+  ASSERT_THROW(m.at("roma"), std::out_of_range);
+  ASSERT_FALSE(m.contains("rubicons"));
+
+  const char* order[] = {"",      "rom",    "romane", "romanus",
+                         "romulus", "rubens", "ruber",  "rubicon"};
+  int i = 0;
+  for (auto it = m.begin(); it != m.end(); ++it)
+    ASSERT_EQ(it->first, order[i++]);
+  ASSERT_EQ(i, 8);
+
+  ASSERT_EQ(m.lower_bound("roma")->first, "romane");
+  ASSERT_EQ(m.lower_bound("rub")->first, "rubens");
+  ASSERT_EQ(m.upper_bound("ruber")->first, "rubicon");
+  ASSERT_EQ(m.lower_bound("s"), m.end());
+
+  auto range = m.prefix_range("roman");
+  ASSERT_EQ(range.first->first, "romane");
+  ASSERT_EQ(std::distance(range.first, range.second), 2);
+
+  ASSERT_EQ(m.erase("rom"), 1);
+  ASSERT_EQ(m.erase("rom"), 0);
+  ASSERT_EQ(m.erase("romulus"), 1);
+  ASSERT_EQ(m.at("romane"), 1);
+  ASSERT_EQ(m.find("romulus"), m.end());
+  ASSERT_EQ(m.find("romanus")->second, 2);
+}
+
+TEST(TestRadixMap, find_and_emplace_iterators_advance) {
+  s21::radix_map<int, int> m;
+  std::map<int, int> ref;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 3000; ++i) {
+    int k = static_cast<int>(gen() % 10000) - 5000;
+    auto res = m.try_emplace(k, i);
+    auto want = ref.try_emplace(k, i);
+    ASSERT_EQ(res.second, want.second);
+    ASSERT_EQ(res.first->second, want.first->second);
+    ++res.first;
+    ++want.first;
+    if (want.first == ref.end())
+      ASSERT_EQ(res.first, m.end());
+    else
+      ASSERT_EQ(res.first->first, want.first->first);
+  }
+  for (int k = -5000; k < 5000; k += 7) {
+    const auto& c = m;
+    auto it = c.find(k);
+    auto want = ref.find(k);
+    if (want == ref.end()) {
+      ASSERT_EQ(it, c.end());
+      continue;
+    }
+    for (int step = 0; step < 3 && want != ref.end(); ++step, ++it, ++want)
+      ASSERT_EQ(it->first, want->first);
+  }
+}
+
+TEST(TestRadixMap, integers_keep_order) {
+  s21::radix_map<int, int> m;
+  std::map<int, int> ref;
+  std::mt19937 gen(36);
+  for (int i = 0; i < 20000; ++i) {
+    int k = static_cast<int>(gen() % 4000) - 2000;
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(m.erase(k), ref.erase(k));
+    } else {
+      m[k] = i;
+      ref[k] = i;
+    }
+  }
+  ASSERT_EQ(m.size(), ref.size());
+  auto it = m.begin();
+  for (auto& kv : ref) {
+    ASSERT_EQ(it->first, kv.first);
+    ASSERT_EQ(it->second, kv.second);
+    ++it;
+  }
+  ASSERT_EQ(it, m.end());
+  ASSERT_EQ(m.lower_bound(-5000)->first, ref.begin()->first);
+  for (int k = -2100; k < 2100; k += 37) {
+    auto lb = ref.lower_bound(k);
+    auto got = m.lower_bound(k);
+    if (lb == ref.end())
+      ASSERT_EQ(got, m.end());
+    else
+      ASSERT_EQ(got->first, lb->first);
+  }
+}
+
+TEST(TestRadixMap, random_strings_against_std) {
+  s21::radix_map<std::string, int> m;
+  std::map<std::string, int> ref;
+  std::mt19937 gen(3600);
+  for (int i = 0; i < 20000; ++i) {
+    std::string k = random_url(gen);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(m.erase(k), ref.erase(k));
+    } else {
+      m.insert_or_assign(k, i);
+      ref[k] = i;
+    }
+    if (i % 1000 == 0) {
+      std::string probe = random_url(gen);
+      auto lb = ref.lower_bound(probe);
+      auto got = m.lower_bound(probe);
+      if (lb == ref.end())
+        ASSERT_EQ(got, m.end());
+      else
+        ASSERT_EQ(got->first, lb->first);
+    }
+  }
+
+  s21::radix_map<std::string, int> copy = m;
+  m.clear();
+  ASSERT_EQ(copy.size(), ref.size());
+  auto it = copy.cbegin();
+  for (auto& kv : ref) {
+    ASSERT_EQ(it->first, kv.first);
+    ASSERT_EQ(it->second, kv.second);
+    ++it;
+  }
+
+  auto range = copy.prefix_range("https://example.com/a");
+  std::size_t n = 0;
+  for (auto& kv : ref)
+    n += kv.first.compare(0, 21, "https://example.com/a") == 0;
+  ASSERT_EQ(static_cast<std::size_t>(std::distance(range.first, range.second)),
+            n);
+}
+
+TEST(TestRadixMap, node_growth_and_shrink) {
+  s21::radix_map<std::string, int> m;
+  for (int b = 0; b < 256; ++b) m[std::string("k") + static_cast<char>(b)] = b;
+  ASSERT_EQ(m.size(), 256);
+  for (int b = 0; b < 256; ++b)
+    ASSERT_EQ(m.at(std::string("k") + static_cast<char>(b)), b);
+  for (int b = 255; b > 0; --b)
+    ASSERT_EQ(m.erase(std::string("k") + static_cast<char>(b)), 1);
+  ASSERT_EQ(m.size(), 1);
+  ASSERT_EQ(m.begin()->first, std::string("k") + '\0');
+}
+
+TEST(TestRadixMap, prefixes_longer_than_stored) {
+  // the shared prefix outgrows the bytes a node keeps, so keys that differ
+  // only past them must be told apart by the leaf compare and by splits
+  const std::string base = "https://www.example.com/catalog/";
+  s21::radix_map<std::string, int> m{{base + "a1", 1}, {base + "a2", 2}};
+  ASSERT_EQ(m.find("https://www.exXmple.com/catalog/a1"), m.end());
+  ASSERT_FALSE(m.contains(base.substr(0, 20)));
+  ASSERT_TRUE(m.insert({"https://www.example.org/x", 3}).second);
+  ASSERT_TRUE(m.insert({base, 4}).second);
+  ASSERT_EQ(m.at(base + "a2"), 2);
+  ASSERT_EQ(m.at("https://www.example.org/x"), 3);
+  ASSERT_EQ(m.lower_bound("https://www.example.com/d")->first,
+            "https://www.example.org/x");
+  ASSERT_EQ(m.lower_bound("https://www.example.com/")->first, base);
+
+  ASSERT_EQ(m.erase("https://www.example.org/x"), 1);
+  ASSERT_EQ(m.erase(base), 1);
+  ASSERT_EQ(m.at(base + "a1"), 1);
+  ASSERT_FALSE(m.contains(base + "a"));
+  ASSERT_EQ(m.lower_bound(base)->first, base + "a1");
+  ASSERT_EQ(m.size(), 2);
+}
+
+TEST(TestRadixMap, throwing_copy_frees_the_partial_tree) {
+  typedef s21::radix_map<std::string, Budgeted> map_type;
+  map_type m;
+  for (int i = 0; i < 100; ++i) m.try_emplace(std::to_string(i));
+  m.try_emplace("");  // a terminal leaf
+  Budgeted::copies_left = 50;
+  ASSERT_THROW(map_type{m}, std::runtime_error);
+  Budgeted::copies_left = -1;
+  map_type copy{m};
+  ASSERT_EQ(copy.size(), m.size());
+}
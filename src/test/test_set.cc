@@ -195,3 +195,21 @@ TEST(TestSet, Emplace4) {
     it1++;
   }
 }
+
+TEST(TestSetFilter, bloom) {
+  s21::set<int, std::less<int>, RBBalance, BloomFilter<int>> s;
+  std::set<int> ref;
+  for (int i = 0; i < 5000; i += 2) {
+    s.insert(i);
+    ref.insert(i);
+  }
+  // erasing most keys makes the filter rebuild itself
+  for (int i = 0; i < 4000; i += 2) ASSERT_EQ(s.erase(i), ref.erase(i));
+  for (int i = -10; i < 5010; ++i)
+    ASSERT_EQ(s.find(i) != s.end(), ref.count(i) == 1);
+
+  s21::set<int, std::less<int>, RBBalance, BloomFilter<int>> copy = s;
+  s.clear();
+  ASSERT_EQ(s.find(4000), s.end());
+  ASSERT_NE(copy.find(4000), copy.end());
+}
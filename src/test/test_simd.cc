@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include "../containers/vector.h"
+#include "../containers_plus/array.h"
+#include "../containers_plus/simd.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+const s21::simd::level kLevels[] = {s21::simd::level::scalar,
+                                    s21::simd::level::sse2,
+                                    s21::simd::level::avx2,
+                                    s21::simd::level::avx512};
+
+class SimdLevels : public ::testing::TestWithParam<s21::simd::level> {
+ protected:
+  void SetUp() override { s21::simd::set_level(GetParam()); }
+  void TearDown() override {
+    s21::simd::set_level(s21::simd::detected_level());
+  }
+};
+
+}  // namespace
+
+TEST_P(SimdLevels, int32_against_std) {
+  std::mt19937 gen(48);
+  for (std::size_t n : {0, 1, 3, 4, 7, 8, 15, 16, 17, 33, 100, 1000}) {
+    s21::vector<std::int32_t> v;
+    for (std::size_t i = 0; i < n; ++i)
+      v.push_back(std::int32_t(gen() % 64) - 32);
+    for (std::int32_t x : {-32, 0, 5, 31, 100}) {
+      auto got = s21::simd::find(v, x);
+      auto want = std::find(v.data(), v.data() + n, x);
+      ASSERT_EQ(&*got - v.data(), want - v.data()) << n << " " << x;
+      ASSERT_EQ(s21::simd::count(v, x),
+                std::size_t(std::count(v.data(), v.data() + n, x)));
+    }
+    if (n == 0) {
+      ASSERT_EQ(s21::simd::find(v, 1), v.end());
+      ASSERT_THROW(s21::simd::min(v), std::out_of_range);
+      continue;
+    }
+    ASSERT_EQ(s21::simd::min(v), *std::min_element(v.data(), v.data() + n));
+    ASSERT_EQ(s21::simd::max(v), *std::max_element(v.data(), v.data() + n));
+    ASSERT_EQ(s21::simd::sum(v), std::accumulate(v.data(), v.data() + n, 0));
+    s21::simd::fill(v, 9);
+    ASSERT_EQ(s21::simd::count(v, 9), n);
+  }
+}
+
+TEST_P(SimdLevels, int32_sum_wraps) {
+  s21::vector<std::int32_t> v(40, INT32_MAX);
+  std::uint32_t want = 0;
+  for (int i = 0; i < 40; ++i) want += std::uint32_t(INT32_MAX);
+  ASSERT_EQ(s21::simd::sum(v), std::int32_t(want));
+}
+
+TEST_P(SimdLevels, float_against_std) {
+  std::mt19937 gen(480);
+  std::uniform_real_distribution<float> dist(-100, 100);
+  for (std::size_t n : {1, 5, 8, 31, 64, 999}) {
+    s21::vector<float> v;
+    for (std::size_t i = 0; i < n; ++i) v.push_back(dist(gen));
+    float probe = v[n / 2];
+    ASSERT_EQ(&*s21::simd::find(v, probe),
+              std::find(v.data(), v.data() + n, probe));
+    ASSERT_EQ(s21::simd::count(v, probe),
+              std::size_t(std::count(v.data(), v.data() + n, probe)));
+    ASSERT_EQ(s21::simd::min(v), *std::min_element(v.data(), v.data() + n));
+    ASSERT_EQ(s21::simd::max(v), *std::max_element(v.data(), v.data() + n));
+    double exact = std::accumulate(v.data(), v.data() + n, 0.0);
+    ASSERT_NEAR(s21::simd::sum(v), exact, 1e-3 * n);
+  }
+}
+
+TEST_P(SimdLevels, array_and_scalar_types) {
+  s21::array<float, 20> a{};
+  s21::simd::fill(a, 2.5f);
+  a[13] = -1.0f;
+  ASSERT_EQ(s21::simd::find(a, -1.0f), a.begin() + 13);
+  ASSERT_EQ(s21::simd::min(a), -1.0f);
+  ASSERT_FLOAT_EQ(s21::simd::sum(a), 19 * 2.5f - 1.0f);
+
+  s21::vector<std::string> s{"b", "a", "c", "a"};
+  ASSERT_EQ(s21::simd::count(s, "a"), 2u);
+  ASSERT_EQ(s21::simd::max(s), "c");
+  s21::vector<double> d{1.5, -2.0, 4.0};
+  ASSERT_EQ(s21::simd::sum(d), 3.5);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestSimd, SimdLevels, ::testing::ValuesIn(kLevels));
@@ -0,0 +1,181 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../containers_plus/small_map.h"
+#include "../containers_plus/small_set.h"
+#include "gtest/gtest.h"
+
+TEST(TestSmallMap, stays_inline) {
+  s21::small_map<int, std::string, 4> m{{3, "c"}, {1, "a"}, {2, "b"}};
+  ASSERT_TRUE(m.is_inline());
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_EQ(m.at(2), "b");
+  ASSERT_THROW(m.at(5), std::out_of_range);
+  ASSERT_FALSE(m.insert({1, "x"}).second);
+  m.insert_or_assign(1, "x");
+  ASSERT_EQ(m[1], "x");
+
+  std::string order;
+  for (auto it = m.begin(); it != m.end(); ++it) order += it.value();
+  ASSERT_EQ(order, "xbc");
+  ASSERT_EQ(*--m.end(), 3);
+  ASSERT_EQ(*m.lower_bound(2), 2);
+  ASSERT_EQ(*m.upper_bound(2), 3);
+  ASSERT_EQ(m.upper_bound(3), m.end());
+}
+
+TEST(TestSmallMap, spills_and_returns) {
+  s21::small_map<int, int, 4> m;
+  for (int i = 0; i < 4; ++i) m[i] = i * 10;
+  ASSERT_TRUE(m.is_inline());
+  m[4] = 40;
+  ASSERT_FALSE(m.is_inline());
+  ASSERT_EQ(m.size(), 5);
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(m.at(i), i * 10);
+  ASSERT_EQ(*--m.end(), 4);
+
+  m.erase(0);
+  m.erase(1);
+  ASSERT_FALSE(m.is_inline());
+  m.erase(2);
+  ASSERT_TRUE(m.is_inline());
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_EQ(m.at(3), 30);
+  ASSERT_EQ(m.at(4), 40);
+}
+
+TEST(TestSmallMap, copy_move_swap) {
+  s21::small_map<std::string, int, 2> a{{"a", 1}};
+  s21::small_map<std::string, int, 2> b{{"x", 1}, {"y", 2}, {"z", 3}};
+  s21::small_map<std::string, int, 2> c = b;
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_EQ(c.at("z"), 3);
+
+  a.swap(b);
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_FALSE(a.is_inline());
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_TRUE(b.is_inline());
+  ASSERT_EQ(b.at("a"), 1);
+
+  s21::small_map<std::string, int, 2> d = std::move(a);
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(d.at("y"), 2);
+  d = b;
+  ASSERT_EQ(d.size(), 1);
+  ASSERT_TRUE(d.is_inline());
+}
+
+TEST(TestSmallMap, random_against_std) {
+  s21::small_map<int, int, 8> m;
+  std::map<int, int> ref;
+  std::mt19937 gen(40);
+  for (int i = 0; i < 5000; ++i) {
+    int k = gen() % 24;
+    if (gen() % 2) {
+      ASSERT_EQ(m.erase(k), ref.erase(k));
+    } else {
+      m.insert_or_assign(k, i);
+      ref[k] = i;
+    }
+    ASSERT_EQ(m.size(), ref.size());
+  }
+  auto it = m.begin();
+  for (auto& kv : ref) {
+    ASSERT_EQ(*it, kv.first);
+    ASSERT_EQ(it.value(), kv.second);
+    ++it;
+  }
+  ASSERT_EQ(it, m.end());
+}
+
+TEST(TestSmallSet, basic) {
+  s21::small_set<int, 3> s{5, 1, 3};
+  ASSERT_TRUE(s.is_inline());
+  ASSERT_TRUE(s.contains(3));
+  ASSERT_FALSE(s.insert(1).second);
+  auto res = s.emplace(7, 9);
+  ASSERT_EQ(res.size(), 2);
+  ASSERT_FALSE(s.is_inline());
+  int expected[] = {1, 3, 5, 7, 9};
+  int i = 0;
+  for (int k : s) ASSERT_EQ(k, expected[i++]);
+  ASSERT_EQ(s.erase(4), 0);
+  ASSERT_EQ(s.erase(9), 1);
+  ASSERT_EQ(s.find(9), s.end());
+}
+
+namespace {
+
+// a string whose copies throw once `copies` more of them were made
+struct Countdown {
+  static int copies;
+  std::string s;
+  Countdown(const char* text) : s{text} {}
+  Countdown(const Countdown& other) : s{other.s} { tick(); }
+  Countdown(Countdown&&) noexcept = default;
+  Countdown& operator=(const Countdown& other) {
+    tick();
+    s = other.s;
+    return *this;
+  }
+  Countdown& operator=(Countdown&&) noexcept = default;
+  bool operator<(const Countdown& other) const { return s < other.s; }
+  bool operator==(const Countdown& other) const { return s == other.s; }
+  bool operator!=(const Countdown& other) const { return s != other.s; }
+  static void tick() {
+    if (copies >= 0 && copies-- == 0) throw std::runtime_error("copy");
+  }
+};
+
+int Countdown::copies = -1;
+
+// a Countdown without a move constructor, so that its moves may throw
+struct Pinned : Countdown {
+  using Countdown::Countdown;
+  Pinned(const Pinned&) = default;
+};
+
+}  // namespace
+
+TEST(TestSmallMap, throwing_copies) {
+  s21::small_map<Countdown, Countdown, 4> m;
+  m.insert({"a heap-sized key, a", "first value"});
+  m.insert({"a heap-sized key, c", "third value"});
+  // a key copy fails halfway through copying the map
+  Countdown::copies = 2;
+  ASSERT_THROW((s21::small_map<Countdown, Countdown, 4>(m)),
+               std::runtime_error);
+  // the value copy of a middle insert fails, the entries stay paired
+  Countdown::copies = 1;
+  ASSERT_THROW(m.insert({"a heap-sized key, b", "second value"}),
+               std::runtime_error);
+  Countdown::copies = -1;
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_EQ(m.at("a heap-sized key, a").s, "first value");
+  ASSERT_EQ(m.at("a heap-sized key, c").s, "third value");
+
+  // a value copy fails while an erase returns the map to the arrays: the
+  // erase still succeeds and the map stays in the tree with all its keys
+  s21::small_map<std::string, Pinned, 4> p;
+  for (const char* k : {"a heap-sized key, 1", "a heap-sized key, 2",
+                        "a heap-sized key, 3", "a heap-sized key, 4",
+                        "a heap-sized key, 5"})
+    p.insert({k, k});
+  ASSERT_EQ(p.erase("a heap-sized key, 5"), 1);
+  ASSERT_EQ(p.erase("a heap-sized key, 4"), 1);
+  Countdown::copies = 1;
+  ASSERT_EQ(p.erase("a heap-sized key, 3"), 1);
+  Countdown::copies = -1;
+  ASSERT_FALSE(p.is_inline());
+  ASSERT_EQ(p.size(), 2);
+  std::string keys;
+  for (auto it = p.begin(); it != p.end(); ++it) keys += *it + ";";
+  ASSERT_EQ(keys, "a heap-sized key, 1;a heap-sized key, 2;");
+  ASSERT_EQ(p.at("a heap-sized key, 2").s, "a heap-sized key, 2");
+  ASSERT_EQ(p.erase("a heap-sized key, 2"), 1);
+  ASSERT_TRUE(p.is_inline());
+  ASSERT_EQ(p.at("a heap-sized key, 1").s, "a heap-sized key, 1");
+}
@@ -0,0 +1,145 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../containers_plus/small_vector.h"
+#include "gtest/gtest.h"
+
+TEST(TestSmallVector, inline_until_full) {
+  s21::small_vector<std::string, 4> v;
+  ASSERT_TRUE(v.is_inline());
+  ASSERT_EQ(v.capacity(), 4);
+  for (int i = 0; i < 4; ++i) v.push_back(std::to_string(i));
+  ASSERT_TRUE(v.is_inline());
+  v.emplace_back(3, 'x');
+  ASSERT_FALSE(v.is_inline());
+  ASSERT_EQ(v.size(), 5);
+  ASSERT_EQ(v.back(), "xxx");
+  ASSERT_EQ(v.at(2), "2");
+  ASSERT_THROW(v.at(5), std::out_of_range);
+
+  v.erase(v.begin() + 1, v.begin() + 3);
+  v.shrink_to_fit();
+  ASSERT_TRUE(v.is_inline());
+  std::vector<std::string> want{"0", "3", "xxx"};
+  ASSERT_EQ(v.size(), want.size());
+  int i = 0;
+  for (const std::string& s : v) ASSERT_EQ(s, want[i++]);
+}
+
+TEST(TestSmallVector, insert_and_erase) {
+  s21::small_vector<int, 8> v{1, 5};
+  std::vector<int> mid{2, 3, 4};
+  v.insert(v.begin() + 1, mid.begin(), mid.end());
+  v.insert(v.end(), 2, 6);
+  v.insert(v.begin(), v[0]);
+  ASSERT_TRUE(v.is_inline());
+  v.insert(v.begin() + 3, 10, 0);
+  ASSERT_FALSE(v.is_inline());
+  ASSERT_EQ(v.size(), 18);
+  v.erase(v.begin() + 3, v.begin() + 13);
+  s21::small_vector<int, 8> want{1, 1, 2, 3, 4, 5, 6, 6};
+  ASSERT_TRUE(v == want);
+  v.resize(3);
+  v.resize(5, 9);
+  ASSERT_EQ(v[4], 9);
+  v.pop_back();
+  ASSERT_EQ(v.size(), 4);
+}
+
+TEST(TestSmallVector, move_steals_heap_buffer) {
+  s21::small_vector<std::unique_ptr<int>, 2> heap;
+  for (int i = 0; i < 5; ++i) heap.push_back(std::make_unique<int>(i));
+  const std::unique_ptr<int>* data = heap.data();
+  s21::small_vector<std::unique_ptr<int>, 2> moved{std::move(heap)};
+  ASSERT_EQ(moved.data(), data);
+  ASSERT_TRUE(heap.empty());
+  ASSERT_TRUE(heap.is_inline());
+
+  s21::small_vector<std::unique_ptr<int>, 2> small;
+  small.push_back(std::make_unique<int>(42));
+  small.swap(moved);
+  ASSERT_EQ(small.size(), 5);
+  ASSERT_EQ(*small[4], 4);
+  ASSERT_EQ(moved.size(), 1);
+  ASSERT_TRUE(moved.is_inline());
+  ASSERT_EQ(*moved[0], 42);
+}
+
+TEST(TestSmallVector, copy_and_assign) {
+  s21::small_vector<std::string, 2> a{"a", "b", "c"};
+  s21::small_vector<std::string, 2> b = a;
+  ASSERT_TRUE(a == b);
+  b = {"x"};
+  ASSERT_EQ(b.size(), 1);
+  a = b;
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(a.front(), "x");
+  a.assign(3, "y");
+  ASSERT_EQ(*a.rbegin(), "y");
+  ASSERT_EQ(a.size(), 3);
+}
+
+TEST(TestSmallVector, uninitialized_append) {
+  s21::small_vector<int, 4> v{1};
+  int* p = v.append_uninitialized(2);
+  p[0] = 2;
+  p[1] = 3;
+  ASSERT_TRUE(v.is_inline());
+  p = v.append_uninitialized(3);
+  for (int i = 0; i < 3; ++i) p[i] = 4 + i;
+  ASSERT_FALSE(v.is_inline());
+  for (int i = 0; i < 6; ++i) ASSERT_EQ(v[i], i + 1);
+  v.resize_uninitialized(2);
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[1], 2);
+}
+
+TEST(TestSmallVector, insert_count_overflow) {
+  s21::small_vector<int, 4> v{1};
+  ASSERT_THROW(v.insert(v.begin(), std::size_t(-1), 5), std::length_error);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_TRUE(v.is_inline());
+  using sv = s21::small_vector<int, 4>;
+  ASSERT_THROW(sv(std::size_t(-1), 5), std::length_error);
+}
+
+TEST(TestSmallVector, growth_policy_and_heap_realloc) {
+  s21::small_vector<int, 2, std::allocator<int>, s21::growth_exact> v{1, 2};
+  v.push_back(3);
+  ASSERT_EQ(v.capacity(), 3);
+  v.insert(v.begin(), 2, 0);
+  ASSERT_EQ(v.capacity(), 5);
+  v.reserve(64);
+  ASSERT_EQ(v.capacity(), 64);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 5);
+  s21::small_vector<int, 2> want{0, 0, 1, 2, 3};
+  ASSERT_EQ(v.size(), want.size());
+  for (std::size_t i = 0; i < v.size(); ++i) ASSERT_EQ(v[i], want[i]);
+}
+
+TEST(TestSmallVector, uninitialized_resize_grows_geometrically) {
+  s21::small_vector<int, 4> v;
+  std::size_t growths = 0;
+  std::size_t capacity = v.capacity();
+  for (std::size_t n = 1; n <= 1000; ++n) {
+    v.resize_uninitialized(n);
+    v[n - 1] = static_cast<int>(n);
+    if (v.capacity() != capacity) ++growths, capacity = v.capacity();
+  }
+  ASSERT_LE(growths, 10);
+  for (std::size_t i = 0; i < v.size(); ++i) ASSERT_EQ(v[i], int(i + 1));
+}
+
+TEST(TestSmallVector, resize_grows_geometrically) {
+  s21::small_vector<std::string, 4> v;
+  std::size_t growths = 0;
+  std::size_t capacity = v.capacity();
+  for (std::size_t n = 1; n <= 1000; ++n) {
+    v.resize(v.size() + 1);
+    if (v.capacity() != capacity) ++growths, capacity = v.capacity();
+  }
+  ASSERT_EQ(v.size(), 1000);
+  ASSERT_LE(growths, 10);
+}
@@ -0,0 +1,58 @@
+#include <string>
+
+#include "../containers_plus/static_map.h"
+#include "gtest/gtest.h"
+
+enum class Opcode { kAdd, kSub, kMul, kDiv };
+
+constexpr auto kOpNames = s21::make_static_map<Opcode, const char*>(
+    {{Opcode::kMul, "mul"},
+     {Opcode::kAdd, "add"},
+     {Opcode::kDiv, "div"},
+     {Opcode::kSub, "sub"}});
+
+static_assert(kOpNames.size() == 4);
+static_assert(kOpNames.contains(Opcode::kDiv));
+static_assert(kOpNames.at(Opcode::kAdd)[0] == 'a');
+static_assert(*kOpNames.begin() == Opcode::kAdd);
+
+constexpr s21::static_map<int, int, 2000> MakeSquares() {
+  std::pair<int, int> items[2000]{};
+  for (int i = 0; i < 2000; ++i) {
+    items[i].first = 1999 - i;
+    items[i].second = (1999 - i) * (1999 - i);
+  }
+  return s21::static_map<int, int, 2000>(items);
+}
+
+constexpr auto kSquares = MakeSquares();
+
+static_assert(kSquares.at(0) == 0);
+static_assert(kSquares.at(1234) == 1234 * 1234);
+static_assert(!kSquares.contains(2000));
+
+TEST(TestStaticMap, find) {
+  ASSERT_EQ(std::string(kOpNames.at(Opcode::kSub)), "sub");
+  ASSERT_EQ(std::string(kOpNames.find(Opcode::kMul).value()), "mul");
+  ASSERT_THROW(kOpNames.at(static_cast<Opcode>(42)), std::out_of_range);
+  ASSERT_TRUE(kOpNames.find(static_cast<Opcode>(42)) == kOpNames.end());
+}
+
+TEST(TestStaticMap, sorted_iteration) {
+  int expected = 0;
+  for (auto it = kSquares.begin(); it != kSquares.end(); ++it, ++expected) {
+    ASSERT_EQ(it.key(), expected);
+    ASSERT_EQ(it.value(), expected * expected);
+  }
+  ASSERT_EQ(expected, 2000);
+  ASSERT_EQ(*kSquares.lower_bound(-5), 0);
+  ASSERT_TRUE(kSquares.lower_bound(5000) == kSquares.end());
+}
+
+TEST(TestStaticMap, runtime_construction) {
+  s21::static_map<std::string, int, 3> m({{"b", 2}, {"c", 3}, {"a", 1}});
+  ASSERT_EQ(*m.begin(), "a");
+  ASSERT_EQ(m.at("c"), 3);
+  ASSERT_THROW((s21::static_map<int, int, 2>({{1, 1}, {1, 2}})),
+               std::invalid_argument);
+}
@@ -0,0 +1,30 @@
+#include <string_view>
+
+#include "../containers_plus/static_set.h"
+#include "gtest/gtest.h"
+
+constexpr auto kKeywords = s21::make_static_set<std::string_view>(
+    {"while", "if", "else", "for", "return"});
+
+static_assert(kKeywords.size() == 5);
+static_assert(kKeywords.contains("for"));
+static_assert(!kKeywords.contains("goto"));
+static_assert(*kKeywords.begin() == "else");
+
+TEST(TestStaticSet, find) {
+  constexpr auto primes = s21::make_static_set<int>({7, 2, 11, 5, 3});
+  ASSERT_EQ(*primes.find(5), 5);
+  ASSERT_TRUE(primes.find(4) == primes.end());
+  ASSERT_EQ(primes.count(11), 1);
+  ASSERT_EQ(*primes.lower_bound(6), 7);
+
+  int prev = 0;
+  for (int p : primes) {
+    ASSERT_LT(prev, p);
+    prev = p;
+  }
+}
+
+TEST(TestStaticSet, duplicate) {
+  ASSERT_THROW((s21::static_set<int, 3>({1, 2, 1})), std::invalid_argument);
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <map>
 #include <random>
+#include <set>
+#include <stdexcept>
 
 #include "../containers/rb_tree.h"
 
@@ -214,3 +218,319 @@ TEST_F(TreeTest, beaces_operator) {
   const RBTree<int, int> t0_cpy = t0;
   ASSERT_EQ(t0[1], 10);
 }
+
+template <class Balance>
+class BalanceTest : public ::testing::Test {
+ protected:
+  typedef RBTree<int, int, std::less<int>, std::allocator<RBNode<int, int>>,
+                 Balance>
+      tree;
+
+  void ExpectSameKeys(tree& t, const std::set<int>& orig) {
+    ASSERT_EQ(t.size(), orig.size());
+    auto it = t.begin();
+    for (int k : orig) ASSERT_EQ(*it++, k);
+    ASSERT_TRUE(it == t.end());
+  }
+
+  template <class Node>
+  static int Height(Node* n) {
+    if (n == nullptr) return 0;
+    return 1 + std::max(Height(n->left), Height(n->right));
+  }
+
+  // every policy keeps the depth within a few log n
+  void ExpectLogHeight(tree& t) {
+    ASSERT_LE(Height(t.get_root()), 4 * std::log2(t.size() + 1.0));
+  }
+};
+
+typedef ::testing::Types<RBBalance, AVLBalance, WAVLBalance, TreapBalance>
+    Balances;
+TYPED_TEST_SUITE(BalanceTest, Balances);
+
+TYPED_TEST(BalanceTest, random_insert_erase) {
+  typename TestFixture::tree t;
+  std::set<int> orig;
+  std::mt19937 gen(42);
+
+  for (int i = 0; i < 2000; ++i) {
+    int k = gen() % 1000;
+    t.insert(std::make_pair(k, k));
+    orig.insert(k);
+    ASSERT_TRUE(t.is_balanced());
+  }
+  this->ExpectSameKeys(t, orig);
+
+  for (int i = 0; i < 2000; ++i) {
+    int k = gen() % 1000;
+    ASSERT_EQ(t.erase(k), orig.erase(k));
+    ASSERT_TRUE(t.is_balanced());
+  }
+  this->ExpectSameKeys(t, orig);
+}
+
+TYPED_TEST(BalanceTest, sequential) {
+  typename TestFixture::tree t;
+  std::set<int> orig;
+
+  for (int i = 0; i < 1000; ++i) {
+    t.insert(std::make_pair(i, -i));
+    orig.insert(i);
+  }
+  ASSERT_TRUE(t.is_balanced());
+  ASSERT_EQ(t.at(500), -500);
+
+  for (int i = 0; i < 1000; i += 2) {
+    t.erase(i);
+    orig.erase(i);
+    ASSERT_TRUE(t.is_balanced());
+  }
+  this->ExpectSameKeys(t, orig);
+
+  typename TestFixture::tree copy{t};
+  ASSERT_TRUE(copy.is_balanced());
+  this->ExpectSameKeys(copy, orig);
+
+  for (int i = 999; i >= 0; --i) t.erase(i);
+  ASSERT_TRUE(t.empty());
+}
+
+TYPED_TEST(BalanceTest, delete_heavy) {
+  typename TestFixture::tree t;
+  std::set<int> orig;
+  std::mt19937 gen(11);
+  for (int i = 0; i < 4096; ++i) {
+    t.insert(std::make_pair(i, i));
+    orig.insert(i);
+  }
+
+  // erasing inner nodes over and over must not skew the shape
+  for (int i = 0; i < 50000; ++i) {
+    int k = gen() % 4096;
+    t.erase(k);
+    t.insert(std::make_pair(k, k));
+  }
+  ASSERT_TRUE(t.is_balanced());
+  this->ExpectLogHeight(t);
+
+  while (orig.size() > 256) {
+    int k = gen() % 4096;
+    ASSERT_EQ(t.erase(k), orig.erase(k));
+  }
+  ASSERT_TRUE(t.is_balanced());
+  this->ExpectLogHeight(t);
+  this->ExpectSameKeys(t, orig);
+}
+
+TYPED_TEST(BalanceTest, augment) {
+  RBTree<int, int, std::less<int>, std::allocator<RBNode<int, int>>,
+         TypeParam, SumAugment<int>>
+      t;
+  std::map<int, int> orig;
+  std::mt19937 gen(3);
+
+  for (int i = 0; i < 1000; ++i) {
+    int k = gen() % 300;
+    if (gen() % 3 == 0) {
+      t.erase(k);
+      orig.erase(k);
+    } else {
+      t.insert_or_assign(k, i);
+      orig[k] = i;
+    }
+
+    int lo = gen() % 300, hi = lo + gen() % 100;
+    int sum = 0;
+    for (auto it = orig.lower_bound(lo); it != orig.end() && it->first < hi;
+         ++it)
+      sum += it->second;
+    ASSERT_EQ(t.aggregate(lo, hi), sum);
+  }
+
+  int total = 0;
+  for (const auto& p : orig) total += p.second;
+  ASSERT_EQ(t.aggregate(), total);
+}
+
+TEST(TreapErase, keeps_priorities) {
+  typedef RBTree<int, int, std::less<int>, std::allocator<RBNode<int, int>>,
+                 TreapBalance>
+      tree;
+  tree t;
+  std::map<int, int> rank;
+  for (int i = 0; i < 1000; ++i) t.insert(std::make_pair(i, i));
+  for (int i = 0; i < 1000; ++i) rank[i] = t.find(i).get_ptr()->rank;
+
+  // an erased key takes its priority along, the others keep theirs
+  for (int i = 0; i < 1000; i += 3) {
+    t.erase(i);
+    rank.erase(i);
+  }
+  ASSERT_TRUE(t.is_balanced());
+  for (const auto& p : rank)
+    ASSERT_EQ(t.find(p.first).get_ptr()->rank, p.second);
+}
+
+TEST(TreapSplitJoin, split_and_join) {
+  typedef RBTree<int, int, std::less<int>, std::allocator<RBNode<int, int>>,
+                 TreapBalance, SumAugment<int>>
+      tree;
+  tree t;
+  std::map<int, int> orig;
+  std::mt19937 gen(29);
+  for (int i = 0; i < 2000; ++i) {
+    int k = gen() % 5000;
+    t.insert_or_assign(k, k % 7);
+    orig[k] = k % 7;
+  }
+
+  for (int cut : {-1, 0, 1234, 2500, 4999, 6000}) {
+    tree rest = t.split(cut);
+    ASSERT_TRUE(t.is_balanced());
+    ASSERT_TRUE(rest.is_balanced());
+    int lsum = 0, rsum = 0;
+    std::size_t lcount = 0;
+    for (const auto& p : orig) {
+      if (p.first < cut) {
+        lsum += p.second;
+        ++lcount;
+      } else {
+        rsum += p.second;
+      }
+    }
+    ASSERT_EQ(t.size(), lcount);
+    ASSERT_EQ(rest.size(), orig.size() - lcount);
+    ASSERT_EQ(t.aggregate(), lsum);
+    ASSERT_EQ(rest.aggregate(), rsum);
+    if (!rest.empty()) {
+      ASSERT_FALSE(*rest.begin() < cut);
+    }
+
+    t.join(rest);
+    ASSERT_TRUE(rest.empty());
+    ASSERT_TRUE(t.is_balanced());
+    ASSERT_EQ(t.size(), orig.size());
+    ASSERT_EQ(t.aggregate(), lsum + rsum);
+    auto it = t.begin();
+    for (const auto& p : orig) ASSERT_EQ(*it++, p.first);
+  }
+
+  tree low, high;
+  low.insert({5, 1});
+  high.insert({3, 1});
+  ASSERT_THROW(low.join(high), std::invalid_argument);
+  ASSERT_EQ(high.size(), 1);
+}
+
+namespace {
+
+int tree_allocations = 0;
+int tree_live_nodes = 0;
+
+template <class T>
+struct counting_allocator {
+  typedef T value_type;
+  template <class U>
+  struct rebind {
+    typedef counting_allocator<U> other;
+  };
+
+  counting_allocator() = default;
+  template <class U>
+  counting_allocator(const counting_allocator<U>&) {}
+
+  T* allocate(std::size_t n) {
+    ++tree_allocations;
+    tree_live_nodes += n;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) {
+    tree_live_nodes -= n;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const counting_allocator&) const { return true; }
+  bool operator!=(const counting_allocator&) const { return false; }
+};
+
+// throws on the copy after copies_left runs out
+struct ThrowingCopy {
+  static int copies_left;
+  int v;
+
+  ThrowingCopy(int x = 0) : v{x} {}
+  ThrowingCopy(const ThrowingCopy& other) : v{other.v} { tick(); }
+  ThrowingCopy& operator=(const ThrowingCopy& other) {
+    tick();
+    v = other.v;
+    return *this;
+  }
+  static void tick() {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+};
+
+int ThrowingCopy::copies_left = -1;
+
+}  // namespace
+
+TEST(TreeRecycling, throwing_copy_frees_nodes) {
+  typedef RBTree<int, ThrowingCopy, std::less<int>,
+                 counting_allocator<RBNode<int, ThrowingCopy>>>
+      tree;
+  tree_live_nodes = 0;
+  {
+    tree a, b;
+    for (int i = 0; i < 100; ++i) a.insert({i, ThrowingCopy(i)});
+    for (int i = 0; i < 60; ++i) b.insert({i * 2, ThrowingCopy(i)});
+
+    ThrowingCopy::copies_left = 30;
+    ASSERT_THROW(tree c(a), std::runtime_error);
+    // fails while reusing b's nodes
+    ThrowingCopy::copies_left = 30;
+    ASSERT_THROW(b = a, std::runtime_error);
+    ASSERT_EQ(b.size(), 0);
+    // fails once b's pool is used up and new nodes are allocated
+    b.insert({1, ThrowingCopy(1)});
+    ThrowingCopy::copies_left = 40;
+    ASSERT_THROW(b = a, std::runtime_error);
+    ThrowingCopy::copies_left = -1;
+    ASSERT_EQ(tree_live_nodes, 100);
+    b = a;
+    ASSERT_EQ(b.size(), 100);
+    ASSERT_EQ(b.at(57).v, 57);
+  }
+  ASSERT_EQ(tree_live_nodes, 0);
+}
+
+TEST(TreeRecycling, copy_assignment_reuses_nodes) {
+  typedef RBTree<int, std::string, std::less<int>,
+                 counting_allocator<RBNode<int, std::string>>>
+      tree;
+  tree a, b;
+  for (int i = 0; i < 100; ++i) a.insert({i, std::to_string(i)});
+  for (int i = 0; i < 100; ++i) b.insert({i * 3, "x"});
+
+  tree_allocations = 0;
+  b = a;
+  ASSERT_EQ(tree_allocations, 0);
+  ASSERT_EQ(b.size(), 100);
+  ASSERT_TRUE(b.is_balanced());
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(b.at(i), std::to_string(i));
+
+  // only the difference is allocated
+  for (int i = 100; i < 110; ++i) a.insert({i, "y"});
+  tree_allocations = 0;
+  b = a;
+  ASSERT_EQ(tree_allocations, 10);
+  ASSERT_EQ(b.size(), 110);
+
+  tree small;
+  small.insert({7, "seven"});
+  tree_allocations = 0;
+  b = small;
+  ASSERT_EQ(tree_allocations, 0);
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_EQ(b.at(7), "seven");
+}
@@ -0,0 +1,211 @@
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../containers_plus/unordered_map.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+struct string_hash {
+  typedef void is_transparent;
+  std::size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+struct string_equal {
+  typedef void is_transparent;
+  bool operator()(std::string_view a, std::string_view b) const {
+    return a == b;
+  }
+};
+
+}  // namespace
+
+TEST(TestUnorderedMap, insert_find_erase) {
+  s21::unordered_map<int, std::string> m{{1, "one"}, {2, "two"}};
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_EQ(m.at(1), "one");
+  ASSERT_THROW(m.at(3), std::out_of_range);
+
+  auto res = m.insert({1, "uno"});
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(res.first->second, "one");
+
+  m.insert_or_assign(1, "uno");
+  ASSERT_EQ(m.at(1), "uno");
+  m[3] = "three";
+  ASSERT_TRUE(m.contains(3));
+  ASSERT_EQ(m.count(4), 0);
+
+  ASSERT_EQ(m.erase(2), 1);
+  ASSERT_EQ(m.erase(2), 0);
+  ASSERT_EQ(m.find(2), m.end());
+  ASSERT_EQ(m.size(), 2);
+}
+
+TEST(TestUnorderedMap, random_against_std) {
+  s21::unordered_map<int, int> m;
+  std::unordered_map<int, int> ref;
+  std::mt19937 gen(33);
+  std::uniform_int_distribution<int> key(0, 5000);
+
+  for (int i = 0; i < 50000; ++i) {
+    int k = key(gen);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(m.erase(k), ref.erase(k));
+    } else {
+      m[k] += i;
+      ref[k] += i;
+    }
+  }
+
+  ASSERT_EQ(m.size(), ref.size());
+  ASSERT_LE(m.load_factor(), m.max_load_factor());
+  std::size_t seen = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++seen)
+    ASSERT_EQ(it->second, ref.at(it->first));
+  ASSERT_EQ(seen, ref.size());
+}
+
+TEST(TestUnorderedMap, erase_while_iterating) {
+  s21::unordered_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m[i] = i;
+  for (auto it = m.cbegin(); it != m.cend();)
+    it = it->first % 2 ? m.erase(it) : ++it;
+  ASSERT_EQ(m.size(), 500);
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(m.contains(i), i % 2 == 0);
+}
+
+TEST(TestUnorderedMap, reserve_and_load_factor) {
+  s21::unordered_map<int, int> m;
+  m.max_load_factor(0.25f);
+  ASSERT_FLOAT_EQ(m.max_load_factor(), 0.25f);
+  m.reserve(1000);
+  std::size_t buckets = m.bucket_count();
+  ASSERT_GE(buckets / 4, 1000);
+  for (int i = 0; i < 1000; ++i) m[i] = i;
+  ASSERT_EQ(m.bucket_count(), buckets);
+
+  m.max_load_factor(2.0f);  // clamped
+  ASSERT_LT(m.max_load_factor(), 1.0f);
+  m.rehash(0);
+  ASSERT_LT(m.bucket_count(), buckets);
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(m.at(i), i);
+}
+
+TEST(TestUnorderedMap, heterogeneous_lookup) {
+  s21::unordered_map<std::string, int, string_hash, string_equal> m;
+  m["apple"] = 1;
+  m["pear"] = 2;
+  std::string_view key = "pear";
+  ASSERT_TRUE(m.contains(key));
+  ASSERT_EQ(m.find(key)->second, 2);
+  ASSERT_EQ(m.find(std::string_view("plum")), m.end());
+}
+
+TEST(TestUnorderedMap, copy_move_swap) {
+  s21::unordered_map<std::string, int> a{{"a", 1}, {"b", 2}};
+  s21::unordered_map<std::string, int> b = a;
+  b["c"] = 3;
+  ASSERT_EQ(a.size(), 2);
+  ASSERT_EQ(b.size(), 3);
+
+  s21::unordered_map<std::string, int> c = std::move(b);
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_TRUE(b.empty());
+
+  a.swap(c);
+  ASSERT_EQ(a.at("c"), 3);
+  ASSERT_FALSE(c.contains("c"));
+  c.clear();
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.begin(), c.end());
+}
+
+TEST(TestUnorderedMap, emplace_from_own_value_across_rehash) {
+  s21::unordered_map<int, std::string> m;
+  m[0] = std::string(100, 'x');
+  int k = 1;
+  // every insertion that fills the table rehashes it
+  for (std::size_t buckets = m.bucket_count(); k < 200; ++k) {
+    m.try_emplace(k, m.at(k - 1));
+    if (m.bucket_count() != buckets) break;
+  }
+  ASSERT_LT(k, 200);
+  ASSERT_EQ(m.at(k), std::string(100, 'x'));
+
+  for (std::size_t buckets = m.bucket_count(); m.bucket_count() == buckets;)
+    m.insert_or_assign(++k, m.at(0));
+  ASSERT_EQ(m.at(k), m.at(0));
+}
+
+namespace {
+
+// a key that counts its copies and can be told to throw on one of them
+template <bool NothrowMove>
+struct counted_key {
+  inline static int copies = 0;
+  inline static int throw_after = -1;
+
+  counted_key(int x) : v{x} {}
+  counted_key(const counted_key& other) : v{other.v} {
+    if (throw_after >= 0 && throw_after-- == 0)
+      throw std::runtime_error("key copy");
+    ++copies;
+  }
+  counted_key(counted_key&& other) noexcept(NothrowMove) : v{other.v} {}
+
+  bool operator==(const counted_key& other) const { return v == other.v; }
+
+  int v;
+};
+
+struct counted_key_hash {
+  template <bool B>
+  std::size_t operator()(const counted_key<B>& k) const {
+    return std::hash<int>()(k.v);
+  }
+};
+
+}  // namespace
+
+TEST(TestUnorderedMap, rehash_moves_keys) {
+  typedef counted_key<true> key;
+  s21::unordered_map<key, int, counted_key_hash> m;
+  key::copies = 0;
+  for (int i = 0; i < 1000; ++i) m.try_emplace(key(i), i);
+  // one copy into the table per insertion, none on rehash
+  ASSERT_EQ(key::copies, 1000);
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(m.at(key(i)), i);
+}
+
+TEST(TestUnorderedMap, throwing_rehash_keeps_table) {
+  typedef counted_key<false> key;
+  // n elements fill the first table, one more rehashes it with key copies
+  s21::unordered_map<int, int> probe{{0, 0}};
+  int n = 1;
+  for (std::size_t b = probe.bucket_count(); probe.bucket_count() == b; ++n)
+    probe[n] = n;
+  --n;
+  s21::unordered_map<key, std::string, counted_key_hash> full;
+  for (int i = 0; i < n; ++i) full.try_emplace(key(i), std::to_string(i));
+  const std::size_t buckets = full.bucket_count();
+
+  for (int fail = 0; fail <= n; ++fail) {
+    key::throw_after = fail;
+    ASSERT_THROW(full.try_emplace(key(n), "new"), std::runtime_error);
+    key::throw_after = -1;
+    ASSERT_EQ(full.size(), std::size_t(n));
+    ASSERT_EQ(full.bucket_count(), buckets);
+    for (int i = 0; i < n; ++i)
+      ASSERT_EQ(full.at(key(i)), std::to_string(i));
+    ASSERT_FALSE(full.contains(key(n)));
+  }
+  full.try_emplace(key(n), "new");
+  ASSERT_EQ(full.size(), std::size_t(n + 1));
+  ASSERT_GT(full.bucket_count(), buckets);
+}
@@ -0,0 +1,34 @@
+#include <set>
+#include <string>
+
+#include "../containers_plus/unordered_set.h"
+#include "gtest/gtest.h"
+
+TEST(TestUnorderedSet, insert_find_erase) {
+  s21::unordered_set<std::string> s{"a", "b", "c"};
+  ASSERT_EQ(s.size(), 3);
+  ASSERT_FALSE(s.insert("a").second);
+  ASSERT_TRUE(s.emplace(3, 'x').second);
+  ASSERT_TRUE(s.contains("xxx"));
+  ASSERT_EQ(*s.find("b"), "b");
+  ASSERT_EQ(s.erase("b"), 1);
+  ASSERT_EQ(s.find("b"), s.end());
+  ASSERT_EQ(s.count("c"), 1);
+}
+
+TEST(TestUnorderedSet, tombstones_are_reused) {
+  s21::unordered_set<int> s;
+  s.reserve(100);
+  std::size_t buckets = s.bucket_count();
+  // a steady size with churning keys must not grow the table
+  for (int i = 0; i < 100000; ++i) {
+    s.insert(i);
+    if (i >= 50) s.erase(i - 50);
+  }
+  ASSERT_EQ(s.size(), 50);
+  ASSERT_EQ(s.bucket_count(), buckets);
+
+  std::set<int> seen(s.begin(), s.end());
+  ASSERT_EQ(seen.size(), 50);
+  ASSERT_EQ(*seen.begin(), 100000 - 50);
+}
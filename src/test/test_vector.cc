@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "../containers/vector.h"
@@ -611,3 +617,264 @@ TEST(vector, reserve_exception) {
   s21::vector<int> vzero;
   ASSERT_ANY_THROW(vzero.reserve(vzero.max_size() + 1));
 }
+
+namespace {
+
+struct Tracked {
+  static int copies, moves, alive;
+  int v;
+  explicit Tracked(int x) : v{x} { ++alive; }
+  Tracked(const Tracked &o) : v{o.v} {
+    ++copies;
+    ++alive;
+  }
+  Tracked(Tracked &&o) noexcept : v{o.v} {
+    ++moves;
+    ++alive;
+  }
+  ~Tracked() { --alive; }
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+int Tracked::alive = 0;
+
+struct Handle {
+  int *p;
+  explicit Handle(int x) : p{new int(x)} {}
+  Handle(Handle &&o) noexcept : p{o.p} { o.p = nullptr; }
+  ~Handle() { delete p; }
+};
+
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<Handle> : std::true_type {};
+
+TEST(vector, growth_moves_and_destroys) {
+  Tracked::copies = Tracked::moves = Tracked::alive = 0;
+  {
+    s21::vector<Tracked> v;
+    for (int i = 0; i < 100; ++i) v.push_back(Tracked(i));
+    v.shrink_to_fit();
+    ASSERT_EQ(Tracked::copies, 0);
+    ASSERT_EQ(Tracked::alive, 100);
+    for (int i = 0; i < 100; ++i) ASSERT_EQ(v[i].v, i);
+  }
+  ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(vector, growth_move_only) {
+  s21::vector<std::unique_ptr<int>> v;
+  for (int i = 0; i < 50; ++i) v.push_back(std::make_unique<int>(i));
+  v.reserve(200);
+  for (int i = 0; i < 50; ++i) ASSERT_EQ(*v[i], i);
+}
+
+TEST(vector, growth_trivially_relocatable) {
+  static_assert(s21::is_trivially_relocatable_v<int>);
+  static_assert(!s21::is_trivially_relocatable_v<std::string>);
+  s21::vector<Handle> v;
+  for (int i = 0; i < 50; ++i) v.push_back(Handle(i));
+  v.shrink_to_fit();
+  for (int i = 0; i < 50; ++i) ASSERT_EQ(*v[i].p, i);
+}
+
+TEST(vector, insert_count_and_range) {
+  s21::vector<std::string> v{"a", "e"};
+  v.reserve(10);
+  auto it = v.insert(v.begin() + 1, 2, std::string("x"));
+  ASSERT_EQ(it, v.begin() + 1);
+  std::vector<std::string> mid{"b", "c", "d"};
+  it = v.insert(v.begin() + 3, mid.begin(), mid.end());
+  ASSERT_EQ(*it, "b");
+  std::vector<std::string> want{"a", "x", "x", "b", "c", "d", "e"};
+  ASSERT_EQ(v.size(), want.size());
+  for (size_t i = 0; i < want.size(); ++i) ASSERT_EQ(v[i], want[i]);
+
+  // value aliasing an element that the insert shifts
+  v.insert(v.begin(), 3, v[6]);
+  ASSERT_EQ(v[0], "e");
+  ASSERT_EQ(v[2], "e");
+  ASSERT_EQ(v[3], "a");
+  ASSERT_EQ(v.size(), 10);
+
+  // growth while inserting a range
+  v.insert(v.begin() + 5, want.begin(), want.end());
+  ASSERT_EQ(v.size(), 17);
+  ASSERT_EQ(v[5], "a");
+  ASSERT_EQ(v[12], "x");
+  ASSERT_EQ(v.back(), "e");
+}
+
+TEST(vector, insert_input_range_and_move_only) {
+  std::istringstream in("3 4 5");
+  s21::vector<int> v{1, 2, 6};
+  v.insert(v.begin() + 2, std::istream_iterator<int>(in),
+           std::istream_iterator<int>());
+  for (int i = 0; i < 6; ++i) ASSERT_EQ(v[i], i + 1);
+
+  s21::vector<std::unique_ptr<int>> u;
+  for (int i = 0; i < 5; ++i) u.insert(u.begin(), std::make_unique<int>(i));
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(*u[i], 4 - i);
+}
+
+namespace {
+
+// a heap-allocated word whose copy throws once copies_left runs out
+struct brittle_word {
+  inline static int copies_left = -1;
+
+  brittle_word() = default;
+  brittle_word(const brittle_word& other) : text{other.text} {
+    if (copies_left >= 0 && copies_left-- == 0)
+      throw std::runtime_error("copy");
+  }
+  brittle_word(brittle_word&&) noexcept = default;
+
+  friend std::istream& operator>>(std::istream& in, brittle_word& w) {
+    return in >> w.text;
+  }
+
+  std::string text;
+};
+
+}  // namespace
+
+TEST(vector, input_range_ctor_throws) {
+  std::istringstream in(
+      "a_word_long_enough_to_live_on_the_heap_1 "
+      "a_word_long_enough_to_live_on_the_heap_2 "
+      "a_word_long_enough_to_live_on_the_heap_3");
+  brittle_word::copies_left = 2;
+  typedef std::istream_iterator<brittle_word> it;
+  ASSERT_THROW((s21::vector<brittle_word>(it(in), it())), std::runtime_error);
+  brittle_word::copies_left = -1;
+}
+
+TEST(vector, range_ctor) {
+  std::list<int> src{1, 2, 3, 4};
+  s21::vector<int> v(src.begin(), src.end());
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v.capacity(), 4);
+  ASSERT_EQ(v[3], 4);
+
+  s21::vector<int> counted(3, 7);
+  ASSERT_EQ(counted.size(), 3);
+  ASSERT_EQ(counted[2], 7);
+}
+
+namespace {
+
+struct Pinned {
+  std::string name;
+  int id;
+  Pinned(std::string n, int i) : name{std::move(n)}, id{i} {}
+  Pinned(const Pinned &) = delete;
+  Pinned(Pinned &&) = default;
+  Pinned &operator=(const Pinned &) = delete;
+  Pinned &operator=(Pinned &&) = default;
+};
+
+}  // namespace
+
+TEST(vector, emplace_in_place) {
+  s21::vector<Pinned> v;
+  for (int i = 0; i < 10; ++i) {
+    Pinned &p = v.emplace_back("p", i);
+    ASSERT_EQ(p.id, i);
+  }
+  auto it = v.emplace(v.begin() + 5, "mid", 100);
+  ASSERT_EQ(it->name, "mid");
+  ASSERT_EQ(v.size(), 11);
+  ASSERT_EQ(v[4].id, 4);
+  ASSERT_EQ(v[6].id, 5);
+  ASSERT_EQ(v.back().id, 9);
+
+  Tracked::copies = Tracked::moves = 0;
+  s21::vector<Tracked> t;
+  t.reserve(4);
+  t.emplace_back(1);
+  t.emplace_back(2);
+  ASSERT_EQ(Tracked::copies, 0);
+  ASSERT_EQ(Tracked::moves, 0);
+}
+
+TEST(vector, emplace_self_reference) {
+  s21::vector<std::string> v{"first", "second"};
+  ASSERT_EQ(v.size(), v.capacity());
+  v.push_back(v[0]);
+  v.emplace_back(v[1]);
+  v.emplace(v.begin(), v[3]);
+  std::vector<std::string> want{"second", "first", "second", "first",
+                                "second"};
+  for (size_t i = 0; i < want.size(); ++i) ASSERT_EQ(v[i], want[i]);
+}
+
+TEST(vector, growth_policies) {
+  s21::vector<int, std::allocator<int>, s21::growth_golden> golden;
+  s21::vector<int, std::allocator<int>, s21::growth_exact> exact;
+  s21::vector<char, std::allocator<char>, s21::growth_size_class> classed;
+  for (int i = 0; i < 10; ++i) {
+    golden.push_back(i);
+    exact.push_back(i);
+    classed.push_back(char(i));
+  }
+  ASSERT_EQ(golden.capacity(), 13);
+  ASSERT_EQ(exact.capacity(), 10);
+  ASSERT_EQ(classed.capacity(), 16);
+  classed.resize(130);
+  ASSERT_EQ(classed.capacity(), 160);
+  ASSERT_EQ(s21::growth_size_class::size_class(129), 160);
+  ASSERT_EQ(s21::growth_size_class::size_class(1000), 1024);
+  ASSERT_EQ(s21::growth_size_class::size_class(1025), 1280);
+}
+
+TEST(vector, resize_within_capacity) {
+  s21::vector<int> v;
+  v.reserve(10);
+  v.resize(4);
+  ASSERT_EQ(v.capacity(), 10);
+  v.resize(10, 7);
+  ASSERT_EQ(v.capacity(), 10);
+  ASSERT_EQ(v[9], 7);
+
+  s21::vector<int, std::allocator<int>, s21::growth_exact> exact;
+  exact.resize(37);
+  ASSERT_EQ(exact.capacity(), 37);
+}
+
+TEST(vector, realloc_growth) {
+  static_assert(s21::vector_base<int>::kUseRealloc);
+  static_assert(!s21::vector_base<std::string>::kUseRealloc);
+  s21::vector<long> v;
+  for (long i = 0; i < 100000; ++i) v.push_back(i);
+  v.insert(v.begin(), 3, -1);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), v.size());
+  ASSERT_EQ(v[2], -1);
+  for (long i = 0; i < 100000; ++i) ASSERT_EQ(v[i + 3], i);
+  v.clear();
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 0);
+  v.push_back(5);
+  ASSERT_EQ(v.front(), 5);
+}
+
+TEST(vector, uninitialized_resize_and_append) {
+  s21::vector<unsigned char> buf;
+  buf.resize_uninitialized(1 << 20);
+  ASSERT_EQ(buf.size(), 1u << 20);
+  std::memset(buf.data(), 0xab, buf.size());
+
+  unsigned char *tail = buf.append_uninitialized(16);
+  ASSERT_EQ(tail, buf.data() + (1 << 20));
+  std::memset(tail, 1, 16);
+  ASSERT_EQ(buf.size(), (1u << 20) + 16);
+  ASSERT_EQ(buf[0], 0xab);
+  ASSERT_EQ(buf.back(), 1);
+
+  buf.resize_uninitialized(4);
+  ASSERT_EQ(buf.size(), 4);
+  ASSERT_EQ(buf[3], 0xab);
+  ASSERT_THROW(buf.append_uninitialized(buf.max_size()), std::length_error);
+}